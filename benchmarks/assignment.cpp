@@ -0,0 +1,113 @@
+// Compares the staged, strongly exception safe assignment of base_any with the
+// destroy-first path it replaced and with the copy-and-move workaround.
+#include <benchmark/benchmark.h>
+#include <ext/any.hpp>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+	using any_t = ext::base_any<32, 8, ext::iface::copy, ext::iface::move>;
+
+	struct relocatable_vector
+	{
+		std::vector<int> values;
+	};
+
+	template<typename T>
+	T make_payload();
+
+	template<>
+	int make_payload<int>()
+	{
+		return 42;
+	}
+
+	template<>
+	std::string make_payload<std::string>()
+	{
+		return std::string(64, 'x');
+	}
+
+	template<>
+	relocatable_vector make_payload<relocatable_vector>()
+	{
+		return relocatable_vector{std::vector<int>(16, 42)};
+	}
+} // namespace
+
+namespace ext
+{
+	template<>
+	struct is_trivially_relocatable<relocatable_vector> : std::true_type
+	{ };
+} // namespace ext
+
+/// the pre-existing behavior: destroy the old object, then copy into the same storage
+template<typename T>
+void assign_destroy_first(benchmark::State& state)
+{
+	any_t source = make_payload<T>();
+	any_t target = make_payload<T>();
+	for(auto _ : state)
+	{
+		target.reset();
+		target = source;
+		benchmark::DoNotOptimize(target);
+	}
+}
+
+/// strongly exception safe assignment, staging and relocating if copying may throw
+template<typename T>
+void assign_staged(benchmark::State& state)
+{
+	any_t source = make_payload<T>();
+	any_t target = make_payload<T>();
+	for(auto _ : state)
+	{
+		target = source;
+		benchmark::DoNotOptimize(target);
+	}
+}
+
+/// the copy-and-move workaround used to get the strong guarantee before
+template<typename T>
+void assign_copy_and_move(benchmark::State& state)
+{
+	any_t source = make_payload<T>();
+	any_t target = make_payload<T>();
+	for(auto _ : state)
+	{
+		any_t copy(source);
+		target = std::move(copy);
+		benchmark::DoNotOptimize(target);
+	}
+}
+
+template<typename T>
+void swap_relocate(benchmark::State& state)
+{
+	any_t lhs = make_payload<T>();
+	any_t rhs = make_payload<T>();
+	for(auto _ : state)
+	{
+		swap(lhs, rhs);
+		benchmark::DoNotOptimize(lhs);
+	}
+}
+
+BENCHMARK_TEMPLATE(assign_destroy_first, int);
+BENCHMARK_TEMPLATE(assign_staged, int);
+BENCHMARK_TEMPLATE(assign_copy_and_move, int);
+BENCHMARK_TEMPLATE(swap_relocate, int);
+
+BENCHMARK_TEMPLATE(assign_destroy_first, std::string);
+BENCHMARK_TEMPLATE(assign_staged, std::string);
+BENCHMARK_TEMPLATE(assign_copy_and_move, std::string);
+BENCHMARK_TEMPLATE(swap_relocate, std::string);
+
+BENCHMARK_TEMPLATE(assign_destroy_first, relocatable_vector);
+BENCHMARK_TEMPLATE(assign_staged, relocatable_vector);
+BENCHMARK_TEMPLATE(assign_copy_and_move, relocatable_vector);
+BENCHMARK_TEMPLATE(swap_relocate, relocatable_vector);
@@ -0,0 +1,93 @@
+// Measures the suspend/resume cost of any_awaitable against an awaitable
+// dispatching through a heap-allocated virtual interface.
+#include <benchmark/benchmark.h>
+#include <ext/any_awaitable.hpp>
+
+#ifdef EXTANY_HAS_COROUTINES
+#include <memory>
+
+namespace
+{
+	/// suspends and reposts the awaiting coroutine, like a timer expiring immediately
+	struct repost
+	{
+		ext::any_scheduler* scheduler;
+		int value;
+
+		bool await_ready() const { return false; }
+		void await_suspend(std::coroutine_handle<> awaiting) const { scheduler->post(awaiting); }
+		int await_resume() const { return value; }
+	};
+
+	/// the awaitable any_awaitable replaces
+	class virtual_awaitable
+	{
+	public:
+		struct interface
+		{
+			virtual ~interface() = default;
+			virtual bool ready() = 0;
+			virtual std::coroutine_handle<> suspend(std::coroutine_handle<> awaiting) = 0;
+			virtual int resume() = 0;
+		};
+
+		template<typename Awaitable>
+		struct model final : interface
+		{
+			explicit model(Awaitable awaitable)
+				: awaitable(awaitable)
+			{ }
+
+			bool ready() override { return awaitable.await_ready(); }
+
+			std::coroutine_handle<> suspend(std::coroutine_handle<> awaiting) override
+			{
+				awaitable.await_suspend(awaiting);
+				return std::noop_coroutine();
+			}
+
+			int resume() override { return awaitable.await_resume(); }
+
+			Awaitable awaitable;
+		};
+
+		template<typename Awaitable>
+		virtual_awaitable(Awaitable awaitable)
+			: impl(std::make_unique<model<Awaitable>>(awaitable))
+		{ }
+
+		bool await_ready() { return impl->ready(); }
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) { return impl->suspend(awaiting); }
+		int await_resume() { return impl->resume(); }
+
+	private:
+		std::unique_ptr<interface> impl;
+	};
+
+	template<typename Awaitable>
+	ext::any_scheduler::task await_loop(ext::any_scheduler& scheduler, std::int64_t count, long& sum)
+	{
+		for(std::int64_t i = 0; i < count; ++i)
+			sum += co_await Awaitable{repost{&scheduler, 1}};
+	}
+} // namespace
+
+template<typename Awaitable>
+void suspend_resume(benchmark::State& state)
+{
+	constexpr std::int64_t awaits = 1024;
+	long sum = 0;
+	for(auto _ : state)
+	{
+		ext::any_scheduler scheduler;
+		scheduler.spawn(await_loop<Awaitable>(scheduler, awaits, sum));
+		scheduler.run();
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * awaits);
+}
+
+BENCHMARK_TEMPLATE(suspend_resume, repost);
+BENCHMARK_TEMPLATE(suspend_resume, virtual_awaitable);
+BENCHMARK_TEMPLATE(suspend_resume, ext::any_awaitable<16, int>);
+#endif
@@ -0,0 +1,60 @@
+# Copyright - 2020 - Jan Christoph Uhde <Jan@UhdeJC.com>
+#
+# Compiles bloat.cpp for every configuration "<types>x<interfaces>" and reports
+# compile time, object size, emitted function tables and interface thunks.
+# Results are printed and written to ${OUTPUT_DIR}/bloat.csv.
+#
+# Required variables: CXX, SOURCE, INCLUDE_DIR, OUTPUT_DIR, CONFIGURATIONS, NM
+# Optional variables: CXX_FLAGS
+
+foreach(required IN ITEMS CXX SOURCE INCLUDE_DIR OUTPUT_DIR CONFIGURATIONS NM)
+    if(NOT DEFINED ${required})
+        message(FATAL_ERROR "bloat.cmake: ${required} is not set")
+    endif()
+endforeach()
+
+function(bloat_now_us out)
+    if(CMAKE_VERSION VERSION_GREATER_EQUAL 3.23)
+        string(TIMESTAMP now "%s%f" UTC)
+    else()
+        string(TIMESTAMP now "%s000000" UTC)
+    endif()
+    set(${out} "${now}" PARENT_SCOPE)
+endfunction()
+
+file(MAKE_DIRECTORY "${OUTPUT_DIR}")
+set(csv "types,interfaces,compile_ms,object_bytes,function_tables,thunks\n")
+message(STATUS "types interfaces compile_ms object_bytes function_tables thunks")
+
+string(REPLACE "," ";" CONFIGURATIONS "${CONFIGURATIONS}")
+foreach(configuration IN LISTS CONFIGURATIONS)
+    string(REPLACE "x" ";" configuration "${configuration}")
+    list(GET configuration 0 types)
+    list(GET configuration 1 interfaces)
+    set(object "${OUTPUT_DIR}/bloat_${types}x${interfaces}.o")
+
+    bloat_now_us(start)
+    execute_process(
+        COMMAND "${CXX}" ${CXX_FLAGS} "-I${INCLUDE_DIR}"
+                "-DEXTANY_BLOAT_TYPES=${types}" "-DEXTANY_BLOAT_INTERFACES=${interfaces}"
+                -c "${SOURCE}" -o "${object}"
+        RESULT_VARIABLE result
+    )
+    bloat_now_us(stop)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "bloat.cmake: compiling ${types}x${interfaces} failed")
+    endif()
+    math(EXPR compile_ms "(${stop} - ${start}) / 1000")
+
+    file(SIZE "${object}" object_bytes)
+    execute_process(COMMAND "${NM}" -C "${object}" OUTPUT_VARIABLE symbols)
+    string(REGEX MATCHALL "table_instance<[^\n]*::value" tables "${symbols}")
+    string(REGEX MATCHALL "invoke_interface<[^\n]*\n" thunks "${symbols}")
+    list(LENGTH tables table_count)
+    list(LENGTH thunks thunk_count)
+
+    message(STATUS "${types} ${interfaces} ${compile_ms} ${object_bytes} ${table_count} ${thunk_count}")
+    string(APPEND csv "${types},${interfaces},${compile_ms},${object_bytes},${table_count},${thunk_count}\n")
+endforeach()
+
+file(WRITE "${OUTPUT_DIR}/bloat.csv" "${csv}")
@@ -0,0 +1,63 @@
+// Instantiates base_any for EXTANY_BLOAT_TYPES payload types, each stored in
+// any-objects with EXTANY_BLOAT_INTERFACES custom interfaces in forward and
+// in reverse order. Compiled by bloat.cmake to measure compile time, object
+// size and the number of emitted function tables and interface thunks.
+#include <ext/any.hpp>
+
+#include <utility>
+
+#ifndef EXTANY_BLOAT_TYPES
+#define EXTANY_BLOAT_TYPES 8
+#endif
+
+#ifndef EXTANY_BLOAT_INTERFACES
+#define EXTANY_BLOAT_INTERFACES 2
+#endif
+
+// external linkage, so that function tables are emitted as named weak symbols like in real code
+namespace bloat
+{
+	template<int I>
+	struct payload
+	{
+		int value;
+	};
+
+	template<int I>
+	struct bloat_interface
+	{
+		using signature_t = int(ext::iface::placeholder const&);
+
+		template<typename T>
+		static int invoke(T const& object)
+		{
+			return object.value + I;
+		}
+	};
+} // namespace bloat
+
+namespace
+{
+	using bloat::payload;
+	using bloat::bloat_interface;
+
+	template<int Type, int... Is>
+	int use(std::integer_sequence<int, Is...>)
+	{
+		constexpr int last = sizeof...(Is) - 1;
+		ext::base_any<8, 8, bloat_interface<Is>...> forward = payload<Type>{Type};
+		ext::base_any<8, 8, bloat_interface<last - Is>...> reverse = payload<Type>{Type};
+		return forward.template call<bloat_interface<0>>() + reverse.template call<bloat_interface<last>>();
+	}
+
+	template<int... Types>
+	int use_all(std::integer_sequence<int, Types...>)
+	{
+		return (use<Types>(std::make_integer_sequence<int, EXTANY_BLOAT_INTERFACES>{}) + ...);
+	}
+} // namespace
+
+int bloat_entry()
+{
+	return use_all(std::make_integer_sequence<int, EXTANY_BLOAT_TYPES>{});
+}
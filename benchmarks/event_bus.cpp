@@ -0,0 +1,109 @@
+// Compares any_event_bus with an event bus built from std::unordered_map,
+// std::type_index and std::function. Messages arrive either in a repeating
+// type pattern, which lets the CPU predict every indirect call, or in random
+// type order, where publish_batch pays off by calling each handler once per
+// batch instead of once per message.
+#include <benchmark/benchmark.h>
+#include <ext/any_event_bus.hpp>
+
+#include <functional>
+#include <random>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	using message_t = ext::any<16>;
+
+	template<int I>
+	struct event
+	{
+		int value;
+	};
+
+	/// the bus any_event_bus replaces
+	class type_index_bus
+	{
+	public:
+		template<typename T, typename Handler>
+		void subscribe(Handler handler)
+		{
+			handlers[typeid(T)].emplace_back([handler](message_t const& message) { handler(ext::any_cast<T>(message)); });
+		}
+
+		void publish(message_t const& message)
+		{
+			auto found = handlers.find(message.type());
+			if(found == handlers.end())
+				return;
+			for(auto& handler : found->second)
+				handler(message);
+		}
+
+	private:
+		std::unordered_map<std::type_index, std::vector<std::function<void(message_t const&)>>> handlers;
+	};
+
+	template<typename Bus, int... Is>
+	void subscribe_all(Bus& bus, long& sum, std::integer_sequence<int, Is...>)
+	{
+		(bus.template subscribe<event<Is>>([&sum](event<Is> const& e) { sum += e.value; }), ...);
+	}
+
+	template<int... Is>
+	std::vector<message_t> make_messages(std::size_t count, bool random_order, std::integer_sequence<int, Is...>)
+	{
+		using factory_t = message_t (*)(int);
+		factory_t factories[] = {[](int v) { return message_t{event<Is>{v}}; }...};
+
+		std::mt19937 random(42);
+		std::vector<message_t> messages;
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			std::size_t type = random_order ? random() % sizeof...(Is) : (i * 7) % sizeof...(Is);
+			messages.push_back(factories[type](static_cast<int>(i)));
+		}
+		return messages;
+	}
+
+	using types = std::make_integer_sequence<int, 8>;
+	constexpr std::size_t message_count = 1024;
+} // namespace
+
+template<typename Bus>
+void publish(benchmark::State& state)
+{
+	Bus bus;
+	long sum = 0;
+	subscribe_all(bus, sum, types{});
+	auto messages = make_messages(message_count, state.range(0) != 0, types{});
+
+	for(auto _ : state)
+	{
+		for(auto const& message : messages)
+			bus.publish(message);
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * message_count);
+}
+
+void publish_batch(benchmark::State& state)
+{
+	ext::any_event_bus<message_t> bus;
+	long sum = 0;
+	subscribe_all(bus, sum, types{});
+	auto messages = make_messages(message_count, state.range(0) != 0, types{});
+
+	for(auto _ : state)
+	{
+		bus.publish_batch(messages);
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * message_count);
+}
+
+// argument: 0 for a repeating type pattern, 1 for random type order
+BENCHMARK_TEMPLATE(publish, type_index_bus)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(publish, ext::any_event_bus<message_t>)->Arg(0)->Arg(1);
+BENCHMARK(publish_batch)->Arg(0)->Arg(1);
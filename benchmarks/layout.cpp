@@ -0,0 +1,42 @@
+// Measures per-thread throughput when every thread updates its own slot in a
+// shared array of any-objects, for the layout policies of base_any.
+#include <benchmark/benchmark.h>
+#include <ext/any.hpp>
+
+namespace
+{
+	constexpr int max_threads = 64;
+
+	// 40 bytes of storage and the function table pointer: the default stride of 48 bytes lets
+	// neighbours share and straddle cache lines, padding to 32 bytes gives a stride of 64 bytes
+	// aligned to 32 bytes only, cache_aligned gives one cache line per any-object
+	using default_t = ext::base_any<40, 8, ext::iface::copy>;
+	using vtable_first_t = ext::base_any<40, 8, ext::layout::vtable_first, ext::iface::copy>;
+	using padded_t = ext::base_any<40, 8, ext::layout::padded<32>, ext::iface::copy>;
+	using cache_aligned_t = ext::base_any<40, 8, ext::layout::cache_aligned, ext::iface::copy>;
+
+	static_assert(sizeof(default_t) == 48 && sizeof(padded_t) == 64, "the padded layout must change the stride");
+
+	template<typename Any>
+	Any slots[max_threads];
+} // namespace
+
+template<typename Any>
+void update_slots(benchmark::State& state)
+{
+	Any& slot = slots<Any>[state.thread_index() % max_threads];
+	slot = 0L;
+	for(auto _ : state)
+	{
+		if(ext::valid_cast<long>(slot))
+			++ext::any_cast<long>(slot);
+		benchmark::ClobberMemory();
+	}
+	state.counters["per_thread"] = benchmark::Counter(
+		static_cast<double>(state.iterations()), benchmark::Counter::kIsRate | benchmark::Counter::kAvgThreads);
+}
+
+BENCHMARK_TEMPLATE(update_slots, default_t)->ThreadRange(1, max_threads)->UseRealTime();
+BENCHMARK_TEMPLATE(update_slots, vtable_first_t)->ThreadRange(1, max_threads)->UseRealTime();
+BENCHMARK_TEMPLATE(update_slots, padded_t)->ThreadRange(1, max_threads)->UseRealTime();
+BENCHMARK_TEMPLATE(update_slots, cache_aligned_t)->ThreadRange(1, max_threads)->UseRealTime();
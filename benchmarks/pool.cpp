@@ -0,0 +1,53 @@
+// Compares creating and destroying any-objects with any_pool against
+// new/delete of std::any holding the same payload, from several threads.
+#include <benchmark/benchmark.h>
+#include <ext/any_pool.hpp>
+
+#include <any>
+#include <array>
+#include <vector>
+
+namespace
+{
+	using payload_t = std::array<long, 16>;
+	using any_t = ext::any<sizeof(payload_t)>;
+	using pool_t = ext::any_pool<any_t>;
+
+	constexpr std::size_t live_objects = 256;
+	constexpr int max_threads = 16;
+} // namespace
+
+void pool_create_destroy(benchmark::State& state)
+{
+	std::vector<any_t*> objects(live_objects);
+	payload_t payload{};
+	for(auto _ : state)
+	{
+		for(auto& object : objects)
+			object = pool_t::create(payload);
+		benchmark::DoNotOptimize(objects.data());
+		for(auto* object : objects)
+			pool_t::destroy(object);
+	}
+	state.SetItemsProcessed(state.iterations() * live_objects);
+	if(state.thread_index() == 0)
+		state.counters["hit_rate"] = pool_t::stats().hit_rate();
+}
+
+void std_any_new_delete(benchmark::State& state)
+{
+	std::vector<std::any*> objects(live_objects);
+	payload_t payload{};
+	for(auto _ : state)
+	{
+		for(auto& object : objects)
+			object = new std::any(payload);
+		benchmark::DoNotOptimize(objects.data());
+		for(auto* object : objects)
+			delete object;
+	}
+	state.SetItemsProcessed(state.iterations() * live_objects);
+}
+
+BENCHMARK(pool_create_destroy)->ThreadRange(1, max_threads)->UseRealTime();
+BENCHMARK(std_any_new_delete)->ThreadRange(1, max_threads)->UseRealTime();
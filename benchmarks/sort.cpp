@@ -0,0 +1,66 @@
+// Compares std::sort with the dispatching any_less comparator against
+// sort_by_type, which sorts each type partition with an inlined operator<.
+#include <benchmark/benchmark.h>
+#include <ext/any_sort.hpp>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+	using record_t = ext::base_any<32, 8, ext::iface::copy, ext::iface::move, ext::iface::less>;
+
+	std::vector<record_t> make_records(std::size_t count)
+	{
+		std::mt19937 random(42);
+		std::vector<record_t> records;
+		records.reserve(count);
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			auto value = random();
+			switch(value % 4)
+			{
+			case 0: records.emplace_back(static_cast<int>(value >> 2)); break;
+			case 1: records.emplace_back(static_cast<double>(value) / 7); break;
+			case 2: records.emplace_back(static_cast<long long>(value) << 8); break;
+			default: records.emplace_back(std::to_string(value)); break;
+			}
+		}
+		return records;
+	}
+} // namespace
+
+void sort_dispatching(benchmark::State& state)
+{
+	auto const records = make_records(static_cast<std::size_t>(state.range(0)));
+	auto sorted = records;
+	for(auto _ : state)
+	{
+		state.PauseTiming();
+		std::copy(records.begin(), records.end(), sorted.begin());
+		state.ResumeTiming();
+		std::sort(sorted.begin(), sorted.end(), ext::any_less{});
+		benchmark::DoNotOptimize(sorted.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void sort_by_type(benchmark::State& state)
+{
+	auto const records = make_records(static_cast<std::size_t>(state.range(0)));
+	auto sorted = records;
+	for(auto _ : state)
+	{
+		state.PauseTiming();
+		std::copy(records.begin(), records.end(), sorted.begin());
+		state.ResumeTiming();
+		ext::sort_by_type(sorted.data(), sorted.data() + sorted.size());
+		benchmark::DoNotOptimize(sorted.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(sort_dispatching)->Range(1 << 10, 1 << 18);
+BENCHMARK(sort_by_type)->Range(1 << 10, 1 << 18);
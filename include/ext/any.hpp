@@ -1,9 +1,12 @@
 #ifndef EXT_ANY_HEADER
 #define EXT_ANY_HEADER
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <new>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 
@@ -11,6 +14,58 @@
 #include <typeinfo>
 #endif
 
+#if __has_include(<version>)
+#include <version>
+#endif
+
+#ifndef EXTANY_CACHE_LINE_SIZE
+#ifdef __cpp_lib_hardware_interference_size
+#define EXTANY_CACHE_LINE_SIZE std::hardware_destructive_interference_size
+#else
+#define EXTANY_CACHE_LINE_SIZE 64
+#endif
+#endif
+
+// constant evaluation of any-objects requires std::bit_cast and constexpr destructors (C++20)
+#if defined(__cpp_lib_bit_cast) && defined(__cpp_lib_is_constant_evaluated) && __cpp_constexpr >= 201907L
+#define EXTANY_HAS_CONSTEXPR
+#define EXTANY_CONSTEXPR constexpr
+#include <array>
+#include <bit>
+#else
+#define EXTANY_CONSTEXPR
+#endif
+
+// checked mode, debug builds only: destroyed any-objects are marked and use of them asserts,
+// storage without an object is poisoned when built with AddressSanitizer
+#if defined(EXTANY_CHECKED) && !defined(NDEBUG)
+#define EXTANY_CHECKS
+#if defined(__SANITIZE_ADDRESS__)
+#define EXTANY_ASAN_POISONING
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define EXTANY_ASAN_POISONING
+#endif
+#endif
+#endif
+
+#ifdef EXTANY_ASAN_POISONING
+#include <sanitizer/asan_interface.h>
+#endif
+
+// the order of function table entries depends on how the compiler spells type names, see
+// _any_detail::type_name; base_any is declared in an inline namespace naming the ordering, so
+// that translation units disagreeing on function table layouts fail to link
+#if defined(__clang__)
+#define EXTANY_INTERFACE_ORDER interface_order_clang
+#elif defined(_MSC_VER)
+#define EXTANY_INTERFACE_ORDER interface_order_msvc
+#elif defined(__GNUC__) && __GNUC__ >= 9
+#define EXTANY_INTERFACE_ORDER interface_order_gnu
+#else
+#define EXTANY_INTERFACE_ORDER interface_order_declared
+#endif
+
 namespace ext
 {
 	namespace iface
@@ -29,6 +84,18 @@ namespace ext
 			using signature_t = void(placeholder&);
 		};
 
+		/// relocation interface definition
+		/**
+			This interface definition is implicitly included in all any-objects. Relocating an object
+			constructs it in the target storage and ends its lifetime in the source storage.
+			\note This is a special interface and is therefore incomplete.
+			      See documentation for how to implement custom interfaces.
+		*/
+		struct relocate
+		{
+			using signature_t = void(placeholder&, char*);
+		};
+
 		/// copy constructor interface definition
 		/**
 			Use this interface to require objects to be copy-constructable
@@ -61,8 +128,47 @@ namespace ext
 
 	} // namespace iface
 
-	// forward declaration
-	template<std::size_t Size, std::size_t Alignment, typename... Interfaces> class base_any;
+	/// layout policies, given to base_any along with its interfaces
+	namespace layout
+	{
+		/// places the function table pointer before the inner object
+		/**
+			The type check and the first bytes of the inner object share a cache line if the
+			any-object is aligned to one, e.g. in combination with `cache_aligned`.
+		*/
+		struct vtable_first
+		{ };
+
+		/// aligns any-objects to N bytes, which pads their size to a multiple of N
+		/**
+			Any-objects in arrays then never straddle an N-byte boundary.
+		*/
+		template<std::size_t N>
+		struct padded
+		{
+			static_assert(N > 0 && (N & (N - 1)) == 0, "padding must be a power of two");
+		};
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+		/// aligns any-objects to the destructive interference size, so that adjacent any-objects never share a cache line
+		/**
+			\note Define EXTANY_CACHE_LINE_SIZE to override the size, which may differ between
+			      compiler versions and target CPUs.
+		*/
+		using cache_aligned = padded<EXTANY_CACHE_LINE_SIZE>;
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+	} // namespace layout
+
+	inline namespace EXTANY_INTERFACE_ORDER
+	{
+		// forward declaration
+		template<std::size_t Size, std::size_t Alignment, typename... Interfaces> class base_any;
+	} // namespace EXTANY_INTERFACE_ORDER
 
 	template<typename>
 	struct is_any : std::false_type
@@ -75,12 +181,193 @@ namespace ext
 	template<class T>
 	inline constexpr bool is_any_v = is_any<T>::value;
 
+	/// customization point for types which may be relocated with `std::memcpy`
+	/**
+		Specialize this trait for types which neither point into themselves nor are referenced by
+		address, e.g. most standard containers. Defaults to `std::is_trivially_copyable`.
+	*/
+	template<typename T>
+	struct is_trivially_relocatable : std::is_trivially_copyable<T>
+	{ };
+
 	namespace _any_detail
 	{
 
 		template<typename T>
 		using remove_cv_ref_t = std::remove_cv_t<std::remove_reference_t<T>>;
 
+#ifdef EXTANY_HAS_CONSTEXPR
+		/// true if objects of T can be stored in any-objects during constant evaluation
+		/**
+			The object representation is copied with std::bit_cast, so T must not contain pointers,
+			references, unions or padding when used in a constant expression.
+		*/
+		template<typename T>
+		inline constexpr bool is_constexpr_storable_v = std::is_trivially_copyable<T>::value;
+
+		/// writes the object representation of `object` to `data` during constant evaluation
+		template<typename T>
+		constexpr void constexpr_store(char* data, T const& object)
+		{
+			auto bytes = std::bit_cast<std::array<char, sizeof(T)>>(object);
+			for(std::size_t i = 0; i < sizeof(T); ++i)
+				data[i] = bytes[i];
+		}
+
+		template<typename T>
+		struct address_probe
+		{
+			static constexpr char value = 0;
+		};
+
+		template<typename T, typename = std::bool_constant<(&address_probe<T>::value != nullptr)>>
+		std::true_type probe_address_comparison(int);
+
+		template<typename T>
+		std::false_type probe_address_comparison(...);
+
+		/// true if addresses can be compared during constant evaluation
+		/**
+			Checking an any-object for a value compares the address of its function table. GCC does
+			not evaluate such comparisons in constant expressions when built with `-fsanitize=null`,
+			which also inserts them for `this` on every member function call.
+		*/
+		inline constexpr bool constant_address_comparison_v = decltype(probe_address_comparison<void>(0))::value;
+
+		/// reads an object of type T from its object representation in `data` during constant evaluation
+		template<typename T>
+		constexpr T constexpr_load(char const* data)
+		{
+			std::array<char, sizeof(T)> bytes{};
+			for(std::size_t i = 0; i < sizeof(T); ++i)
+				bytes[i] = data[i];
+			return std::bit_cast<T>(bytes);
+		}
+#endif
+
+		template<typename... Ts>
+		struct type_list
+		{ };
+
+		/// alignment requested by a layout policy, one for interfaces
+		template<typename T>
+		struct policy_alignment : std::integral_constant<std::size_t, 1>
+		{ };
+
+		template<std::size_t N>
+		struct policy_alignment<layout::padded<N>> : std::integral_constant<std::size_t, N>
+		{ };
+
+		template<typename T>
+		inline constexpr bool is_layout_policy_v = std::is_same<T, layout::vtable_first>::value || policy_alignment<T>::value > 1;
+
+		/// alignment of base_any, given its alignment parameter and layout policies
+		template<std::size_t Alignment, typename... Interfaces>
+		inline constexpr std::size_t any_alignment_v = std::max({Alignment, policy_alignment<Interfaces>::value...});
+
+		/// storage of base_any, ordered as requested by its layout policies
+		template<bool VTableFirst, std::size_t Size, std::size_t Alignment, typename VTable>
+		struct storage
+		{
+			constexpr storage(VTable const* vtable)
+				: vtable(vtable)
+			{ }
+
+			alignas(Alignment) char data[Size];
+			VTable const* vtable;
+		};
+
+		template<std::size_t Size, std::size_t Alignment, typename VTable>
+		struct storage<true, Size, Alignment, VTable>
+		{
+			constexpr storage(VTable const* vtable)
+				: vtable(vtable)
+			{ }
+
+			VTable const* vtable;
+			alignas(Alignment) char data[Size];
+		};
+
+		/// true if `Interface` is one of `Interfaces`
+		template<typename Interface, typename... Interfaces>
+		inline constexpr bool has_interface_v = (std::is_same<Interface, Interfaces>::value || ...);
+
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 9) || defined(_MSC_VER)
+#define EXTANY_CANONICAL_INTERFACES
+		/// returns a string unique to T, used to order types at compile time
+		template<typename T>
+		constexpr std::string_view type_name()
+		{
+#if defined(_MSC_VER) && !defined(__clang__)
+			return __FUNCSIG__;
+#else
+			return __PRETTY_FUNCTION__;
+#endif
+		}
+
+		template<typename Lhs, typename Rhs>
+		inline constexpr bool type_less = type_name<Lhs>() < type_name<Rhs>();
+#else
+		// no compile time type names, interfaces keep their given order
+		template<typename Lhs, typename Rhs>
+		inline constexpr bool type_less = false;
+#endif
+
+		/// inserts T into the sorted type list `List` unless it is already contained
+		template<typename T, typename List, typename = void>
+		struct sorted_insert;
+
+		template<typename T>
+		struct sorted_insert<T, type_list<>>
+		{
+			using type = type_list<T>;
+		};
+
+		template<typename T, typename Head, typename... Tail>
+		struct sorted_insert<T, type_list<Head, Tail...>, std::enable_if_t<std::is_same<T, Head>::value>>
+		{
+			using type = type_list<Head, Tail...>;
+		};
+
+		template<typename T, typename Head, typename... Tail>
+		struct sorted_insert<T, type_list<Head, Tail...>, std::enable_if_t<!std::is_same<T, Head>::value && type_less<T, Head>>>
+		{
+			using type = type_list<T, Head, Tail...>;
+		};
+
+		template<typename T, typename Head, typename... Tail>
+		struct sorted_insert<T, type_list<Head, Tail...>, std::enable_if_t<!std::is_same<T, Head>::value && !type_less<T, Head>>>
+		{
+			template<typename List>
+			struct prepend_head;
+
+			template<typename... Ts>
+			struct prepend_head<type_list<Ts...>>
+			{
+				using type = type_list<Head, Ts...>;
+			};
+
+			using type = typename prepend_head<typename sorted_insert<T, type_list<Tail...>>::type>::type;
+		};
+
+		/// sorts and deduplicates interface lists, so that all orderings of the same interfaces share one function table
+		template<typename List, typename... Interfaces>
+		struct canonical
+		{
+			using type = List;
+		};
+
+		template<typename List, typename Interface, typename... Interfaces>
+		struct canonical<List, Interface, Interfaces...>
+			: canonical<
+				typename std::conditional_t<is_layout_policy_v<Interface>, canonical<List>, sorted_insert<Interface, List>>::type,
+				Interfaces...
+			>
+		{ };
+
+		template<typename... Interfaces>
+		using canonical_t = typename canonical<type_list<>, Interfaces...>::type;
+
 		/// interface function dispatcher
 		template<typename Interface, typename Signature>
 		struct dispatch_impl;
@@ -93,8 +380,30 @@ namespace ext
 
 			/// converts `data` into `T` and calls the given interface function with its `object` member
 			template<typename T>
-			static Return invoke_interface(char* data, Params... params)
+			static EXTANY_CONSTEXPR Return invoke_interface(char* data, Params... params)
 			{
+#ifdef EXTANY_HAS_CONSTEXPR
+				if constexpr(is_constexpr_storable_v<T>)
+				{
+					if(std::is_constant_evaluated())
+					{
+						// work on a copy and write back its representation, as data cannot be reinterpreted
+						T object = constexpr_load<T>(data);
+						if constexpr(std::is_void<Return>::value)
+						{
+							Interface::template invoke(object, std::forward<Params>(params)...);
+							constexpr_store(data, object);
+							return;
+						}
+						else
+						{
+							Return result = Interface::template invoke(object, std::forward<Params>(params)...);
+							constexpr_store(data, object);
+							return result;
+						}
+					}
+				}
+#endif
 				return Interface::template invoke(*reinterpret_cast<T*>(data), std::forward<Params>(params)...);
 			}
 		};
@@ -107,8 +416,13 @@ namespace ext
 
 			/// converts `data` into `T const*` and calls the given interface function with its `object` member
 			template<typename T>
-			static Return invoke_interface(char const* data, Params... params)
+			static EXTANY_CONSTEXPR Return invoke_interface(char const* data, Params... params)
 			{
+#ifdef EXTANY_HAS_CONSTEXPR
+				if constexpr(is_constexpr_storable_v<T>)
+					if(std::is_constant_evaluated())
+						return Interface::template invoke(constexpr_load<T>(data), std::forward<Params>(params)...);
+#endif
 				return Interface::template invoke(*reinterpret_cast<T const*>(data), std::forward<Params>(params)...);
 			}
 		};
@@ -152,6 +466,29 @@ namespace ext
 			}
 		};
 
+		/// interface function dispatcher for `iface::relocate`
+		template<>
+		struct dispatch_impl<iface::relocate, void(iface::placeholder&, char*)>
+		{
+			using function_t = void(*)(char*, char*);
+
+			template<typename T>
+			static void invoke_interface(char* data, char* target)
+			{
+				if constexpr(is_trivially_relocatable<T>::value)
+					std::memcpy(target, data, sizeof(T));
+				else
+				{
+					T& object = *reinterpret_cast<T*>(data);
+					if constexpr(std::is_move_constructible<T>::value)
+						new(target) T(std::move(object));
+					else
+						new(target) T(object);
+					object.~T();
+				}
+			}
+		};
+
 #ifndef EXT_NO_RTTI
 		/// interface function dispatcher for `iface::type_info`
 		template<>
@@ -178,33 +515,113 @@ namespace ext
 		struct table_entry
 		{
 			typename dispatch<Interface>::function_t function;
+
+			template<typename T>
+			static constexpr table_entry make()
+			{
+				return {dispatch<Interface>::template invoke_interface<T>};
+			}
+		};
+
+		/// function table entry for `iface::destroy`
+		/**
+			Holds no function for trivially destructible types, whose destruction is skipped.
+		*/
+		template<>
+		struct table_entry<iface::destroy>
+		{
+			typename dispatch<iface::destroy>::function_t function;
+
+			template<typename T>
+			static constexpr table_entry make()
+			{
+				if constexpr(std::is_trivially_destructible<T>::value)
+					return {nullptr};
+				else
+					return {dispatch<iface::destroy>::invoke_interface<T>};
+			}
+		};
+
+		/// function table entry for `iface::relocate`
+		/**
+			Additionally records which operations on the type cannot throw. Assignments use these flags to
+			decide whether the new object has to be staged before the old one is destroyed.
+		*/
+		template<>
+		struct table_entry<iface::relocate>
+		{
+			typename dispatch<iface::relocate>::function_t function;
+			bool nothrow_copy;
+			bool nothrow_move;
+			bool nothrow_relocate;
+
+			template<typename T>
+			static constexpr table_entry make()
+			{
+				constexpr bool relocatable = std::is_move_constructible<T>::value || std::is_copy_constructible<T>::value;
+				if constexpr(relocatable)
+					return {
+						dispatch<iface::relocate>::invoke_interface<T>,
+						std::is_nothrow_copy_constructible<T>::value,
+						std::is_nothrow_move_constructible<T>::value,
+						is_trivially_relocatable<T>::value || std::is_nothrow_move_constructible<T>::value
+					};
+				else
+					return {nullptr, false, false, false};
+			}
 		};
 
 		/// function table for custom interfaces
 		template<typename... Interfaces>
 		struct fn_table : table_entry<Interfaces>...
 		{
-			constexpr fn_table(typename dispatch<Interfaces>::function_t... fn_ptrs)
-				: table_entry<Interfaces>{fn_ptrs}...
+			constexpr fn_table(table_entry<Interfaces>... entries)
+				: table_entry<Interfaces>(entries)...
 			{ }
 		};
 
-		/// function table instance for given T and interfaces
-		template<typename T, typename... Interfaces>
-		fn_table<
-			iface::destroy,
+		/// function table type for a canonical interface list, including the implicit interfaces
+		template<typename List>
+		struct vtable_for;
+
+		template<typename... Interfaces>
+		struct vtable_for<type_list<Interfaces...>>
+		{
+			using type = fn_table<
+				iface::destroy,
+				iface::relocate,
 #ifndef EXT_NO_RTTI
-			iface::type_info,
+				iface::type_info,
 #endif
-			Interfaces...
-		> constexpr function_table{
-			dispatch<iface::destroy>::invoke_interface<T>,
+				Interfaces...
+			>;
+		};
+
+		/// function table type for given interfaces
+		template<typename... Interfaces>
+		using vtable_t = typename vtable_for<canonical_t<Interfaces...>>::type;
+
+		/// function table instance for given T and canonical interface list
+		template<typename T, typename List>
+		struct table_instance;
+
+		template<typename T, typename... Interfaces>
+		struct table_instance<T, type_list<Interfaces...>>
+		{
+			static constexpr typename vtable_for<type_list<Interfaces...>>::type value{
+				table_entry<iface::destroy>::make<T>(),
+				table_entry<iface::relocate>::make<T>(),
 #ifndef EXT_NO_RTTI
-			dispatch<iface::type_info>::invoke_interface<T>,
+				table_entry<iface::type_info>::make<T>(),
 #endif
-			dispatch<Interfaces>::template invoke_interface<T>...
+				table_entry<Interfaces>::template make<T>()...
+			};
 		};
 
+		/// function table instance for given T and interfaces
+		template<typename T, typename... Interfaces>
+		constexpr vtable_t<Interfaces...> const& function_table = table_instance<T, canonical_t<Interfaces...>>::value;
+
 		/// returns a unique integer, identifying the type and its interfaces associated with given vtable
 		template<typename Ptr>
 		std::uintptr_t typeid_by_vtable(Ptr* vtable_ptr)
@@ -218,281 +635,585 @@ namespace ext
 		{
 			return reinterpret_cast<std::uintptr_t>(&function_table<T, Interfaces...>);
 		}
+
+#ifdef EXTANY_CHECKS
+		/// stands in for the function table of destroyed any-objects
+		alignas(void*) inline constexpr char destroyed_table = 0;
+
+		template<typename VTable>
+		VTable const* destroyed_vtable()
+		{
+			return reinterpret_cast<VTable const*>(&destroyed_table);
+		}
+#endif
+
+		/// grants extensions of base_any access to its internals
+		struct access;
 	} // namespace _any_detail
 
-	/// any-object, which can carry any object satisfying all given interfaces
-	/**
-		\code{.cpp}
-		\endcode
-	*/
-	template<std::size_t Size, std::size_t Alignment, typename... Interfaces>
-	class alignas(Alignment) base_any
+	inline namespace EXTANY_INTERFACE_ORDER
 	{
-	public:
-		constexpr static std::size_t size = Size;
-		constexpr static std::size_t alignment = Alignment;
-
-		template<typename OtherType, std::size_t OtherSize, std::size_t OtherAlignment, typename... OtherInterface>
-		friend OtherType& any_cast(base_any<OtherSize, OtherAlignment, OtherInterface...>& a);
+		/// any-object, which can carry any object satisfying all given interfaces
+		/**
+			Layout policies from the `layout` namespace may be given along with the interfaces.
+			\note The order of the function table entries depends on the type names the compiler
+			      generates (see EXTANY_INTERFACE_ORDER). Any-objects must not be passed between
+			      code built by compilers ordering differently; this fails to link as base_any is
+			      declared in an inline namespace named after the ordering. Dynamically loaded
+			      libraries are not checked by the linker.
+			\note Define EXTANY_CHECKED in debug builds to detect use of destroyed any-objects and, with
+			      AddressSanitizer, access to the storage of empty any-objects.
+			\code{.cpp}
+			\endcode
+		*/
+		template<std::size_t Size, std::size_t Alignment, typename... Interfaces>
+		class alignas(_any_detail::any_alignment_v<Alignment, Interfaces...>) base_any
+			: private _any_detail::storage<
+				_any_detail::has_interface_v<layout::vtable_first, Interfaces...>,
+				Size, Alignment, _any_detail::vtable_t<Interfaces...>
+			>
+		{
+			using storage_t = _any_detail::storage<
+				_any_detail::has_interface_v<layout::vtable_first, Interfaces...>,
+				Size, Alignment, _any_detail::vtable_t<Interfaces...>
+			>;
 
-		template<typename OtherType, std::size_t OtherSize, std::size_t OtherAlignment, typename... OtherInterface>
-		friend OtherType const& any_cast(base_any<OtherSize, OtherAlignment, OtherInterface...> const& a);
+		public:
+			constexpr static std::size_t size = Size;
+			constexpr static std::size_t alignment = Alignment;
 
-		template<typename OtherType, std::size_t OtherSize, std::size_t OtherAlignment, typename... OtherInterface>
-		friend bool valid_cast(base_any<OtherSize, OtherAlignment, OtherInterface...>& a);
+			template<typename OtherType, std::size_t OtherSize, std::size_t OtherAlignment, typename... OtherInterface>
+			friend OtherType& any_cast(base_any<OtherSize, OtherAlignment, OtherInterface...>& a);
 
-		template<typename OtherType, std::size_t OtherSize, std::size_t OtherAlignment, typename... OtherInterface>
-		friend bool valid_cast(base_any<OtherSize, OtherAlignment, OtherInterface...> const& a);
+			template<typename OtherType, std::size_t OtherSize, std::size_t OtherAlignment, typename... OtherInterface>
+			friend OtherType const& any_cast(base_any<OtherSize, OtherAlignment, OtherInterface...> const& a);
 
-		~base_any()
-		{
-			destroy();
-		}
+			template<typename OtherType, std::size_t OtherSize, std::size_t OtherAlignment, typename... OtherInterface>
+			friend EXTANY_CONSTEXPR bool valid_cast(base_any<OtherSize, OtherAlignment, OtherInterface...>& a);
 
-		base_any()
-			: vtable(nullptr)
-		{ }
+			template<typename OtherType, std::size_t OtherSize, std::size_t OtherAlignment, typename... OtherInterface>
+			friend EXTANY_CONSTEXPR bool valid_cast(base_any<OtherSize, OtherAlignment, OtherInterface...> const& a);
 
-		template<
-			typename T,
-			typename = std::enable_if_t<!std::is_same<std::decay_t<T>, base_any>::value>
-		>
-		base_any(T&& object)
-			: vtable(&_any_detail::function_table<std::decay_t<T>, Interfaces...>)
-		{
-			static_assert(sizeof(std::decay_t<T>) <= size, "given object does not fit into this any-object");
-			static_assert(alignof(std::decay_t<T>) <= alignment, "given object requires a stricter alignment");
-			new(data) std::decay_t<T>(std::forward<T>(object));
-		}
+			friend struct _any_detail::access;
 
-		template<
-			typename T,
-			typename = std::enable_if_t<!std::is_same<std::decay_t<T>, base_any>::value>
-		>
-		base_any& operator=(T&& object)
-		{
-			static_assert(sizeof(std::decay_t<T>) <= size, "given object does not fit into this any-object");
-			static_assert(alignof(std::decay_t<T>) <= alignment, "given object requires a stricter alignment");
-			destroy();
-			vtable = &_any_detail::function_table<std::decay_t<T>, Interfaces...>;
-			new(data) std::decay_t<T>(std::forward<T>(object));
-			return *this;
-		}
+			EXTANY_CONSTEXPR ~base_any()
+			{
+				destroy();
+				mark_destroyed();
+			}
 
-		base_any(base_any const& other)
-			: vtable(other.vtable)
-		{
-			static_assert(std::is_base_of<_any_detail::table_entry<iface::copy>, _any_detail::fn_table<Interfaces...>>::value,
-				"this any-object has no interface for copy construction");
+			EXTANY_CONSTEXPR base_any()
+				: storage_t(nullptr)
+			{
+#ifdef EXTANY_HAS_CONSTEXPR
+				if(std::is_constant_evaluated())
+					clear_data();
+#endif
+				poison_data();
+			}
 
-			assert(this != &other && "ill formed initialization");
-			if(other.has_value())
-				other.interface<iface::copy>().function(other.data, data);
-		}
+			template<
+				typename T,
+				typename = std::enable_if_t<!std::is_same<std::decay_t<T>, base_any>::value>
+			>
+			EXTANY_CONSTEXPR base_any(T&& object)
+				: storage_t(&_any_detail::function_table<std::decay_t<T>, Interfaces...>)
+			{
+				static_assert(sizeof(std::decay_t<T>) <= size, "given object does not fit into this any-object");
+				static_assert(alignof(std::decay_t<T>) <= alignment, "given object requires a stricter alignment");
+#ifdef EXTANY_HAS_CONSTEXPR
+				if constexpr(_any_detail::is_constexpr_storable_v<std::decay_t<T>>)
+				{
+					if(std::is_constant_evaluated())
+					{
+						clear_data();
+						_any_detail::constexpr_store<std::decay_t<T>>(data, object);
+						return;
+					}
+				}
+#endif
+				unpoison_data();
+				new(data) std::decay_t<T>(std::forward<T>(object));
+			}
 
-		base_any(base_any&& other)
-			: vtable(other.vtable)
-		{
-			static_assert(
-				std::is_base_of<_any_detail::table_entry<iface::move>, _any_detail::fn_table<Interfaces...>>::value
-				|| std::is_base_of<_any_detail::table_entry<iface::copy>, _any_detail::fn_table<Interfaces...>>::value,
-				"this any-object has neither an interface for move construction nor an interface for copy construction");
+			template<
+				typename T,
+				typename = std::enable_if_t<!std::is_same<std::decay_t<T>, base_any>::value>
+			>
+			base_any& operator=(T&& object)
+			{
+				using object_t = std::decay_t<T>;
+				static_assert(sizeof(object_t) <= size, "given object does not fit into this any-object");
+				static_assert(alignof(object_t) <= alignment, "given object requires a stricter alignment");
+				replace(&_any_detail::function_table<object_t, Interfaces...>, std::is_nothrow_constructible<object_t, T&&>::value,
+					[&object](char* target) { new(target) object_t(std::forward<T>(object)); });
+				return *this;
+			}
 
-			if(other.has_value())
+			EXTANY_CONSTEXPR base_any(base_any const& other)
+				: storage_t(other.vtable)
 			{
+				static_assert(_any_detail::has_interface_v<iface::copy, Interfaces...>,
+					"this any-object has no interface for copy construction");
+
 				assert(this != &other && "ill formed initialization");
-				if constexpr(std::is_base_of<_any_detail::table_entry<iface::move>, _any_detail::fn_table<Interfaces...>>::value)
-					other.interface<iface::move>().function(other.data, data);
-				else if(std::is_base_of<_any_detail::table_entry<iface::copy>, _any_detail::fn_table<Interfaces...>>::value)
-					other.interface<iface::copy>().function(other.data, data); // fall back to copy construction
+#ifdef EXTANY_HAS_CONSTEXPR
+				if(std::is_constant_evaluated())
+				{
+					// only trivially copyable objects can be stored during constant evaluation
+					for(std::size_t i = 0; i < size; ++i)
+						data[i] = other.data[i];
+					return;
+				}
+#endif
+				if(other.has_value())
+				{
+					unpoison_data();
+					other.interface<iface::copy>().function(other.data, data);
+				}
+				else
+					poison_data();
 			}
-			else
-				vtable = nullptr;
-		}
-
-		base_any& operator= (base_any const& other)
-		{
-			static_assert(std::is_base_of<_any_detail::table_entry<iface::copy>, _any_detail::fn_table<Interfaces...>>::value,
-				"this any-object has no interface for copy construction");
 
-			if(this == &other)
-				return *this;
+			base_any(base_any&& other)
+				: storage_t(other.vtable)
+			{
+				static_assert(
+					_any_detail::has_interface_v<iface::move, Interfaces...>
+					|| _any_detail::has_interface_v<iface::copy, Interfaces...>,
+					"this any-object has neither an interface for move construction nor an interface for copy construction");
+
+				if(other.has_value())
+				{
+					assert(this != &other && "ill formed initialization");
+					unpoison_data();
+					if constexpr(_any_detail::has_interface_v<iface::move, Interfaces...>)
+						other.interface<iface::move>().function(other.data, data);
+					else if(_any_detail::has_interface_v<iface::copy, Interfaces...>)
+						other.interface<iface::copy>().function(other.data, data); // fall back to copy construction
+				}
+				else
+				{
+					vtable = nullptr;
+					poison_data();
+				}
+			}
 
-			destroy();
-			if(other.has_value())
-				other.interface<iface::copy>().function(other.data, data);
-			vtable = other.vtable;
-			return *this;
-		}
+			base_any& operator= (base_any const& other)
+			{
+				static_assert(_any_detail::has_interface_v<iface::copy, Interfaces...>,
+					"this any-object has no interface for copy construction");
 
-		base_any& operator= (base_any&& other)
-		{
-			static_assert(
-				std::is_base_of<_any_detail::table_entry<iface::move>, _any_detail::fn_table<Interfaces...>>::value
-				|| std::is_base_of<_any_detail::table_entry<iface::copy>, _any_detail::fn_table<Interfaces...>>::value,
-				"this any-object has neither an interface for move construction nor an interface for copy construction");
+				if(this == &other)
+					return *this;
 
-			if(this == &other)
+				if(!other.has_value())
+					reset();
+				else
+					replace(other.vtable, other.interface<iface::relocate>().nothrow_copy,
+						[&other](char* target) { other.interface<iface::copy>().function(other.data, target); });
 				return *this;
+			}
 
-			destroy();
-			if(other.has_value())
+			base_any& operator= (base_any&& other)
 			{
-				if constexpr(std::is_base_of<_any_detail::table_entry<iface::move>, _any_detail::fn_table<Interfaces...>>::value)
-					other.interface<iface::move>().function(other.data, data);
-				else if(std::is_base_of<_any_detail::table_entry<iface::copy>, _any_detail::fn_table<Interfaces...>>::value)
-					other.interface<iface::copy>().function(other.data, data); // fall back to copy construction
+				static_assert(
+					_any_detail::has_interface_v<iface::move, Interfaces...>
+					|| _any_detail::has_interface_v<iface::copy, Interfaces...>,
+					"this any-object has neither an interface for move construction nor an interface for copy construction");
+
+				if(this == &other)
+					return *this;
+
+				if(!other.has_value())
+					reset();
+				else if constexpr(_any_detail::has_interface_v<iface::move, Interfaces...>)
+					replace(other.vtable, other.interface<iface::relocate>().nothrow_move,
+						[&other](char* target) { other.interface<iface::move>().function(other.data, target); });
+				else
+					replace(other.vtable, other.interface<iface::relocate>().nothrow_copy,
+						[&other](char* target) { other.interface<iface::copy>().function(other.data, target); }); // fall back to copy construction
+				return *this;
+			}
 
+			/// exchanges the inner objects of this and `other`
+			/**
+				Objects are relocated if both types are nothrow relocatable, otherwise this falls back
+				to move construction and move assignment.
+				\see is_trivially_relocatable
+			*/
+			void swap(base_any& other)
+			{
+				static_assert(
+					_any_detail::has_interface_v<iface::move, Interfaces...>
+					|| _any_detail::has_interface_v<iface::copy, Interfaces...>,
+					"this any-object has neither an interface for move construction nor an interface for copy construction");
+
+				if(this == &other)
+					return;
+
+				if(nothrow_relocatable() && other.nothrow_relocatable())
+				{
+					alignas(Alignment) char staged[size];
+					if(has_value())
+						interface<iface::relocate>().function(data, staged);
+					unpoison_data();
+					other.unpoison_data();
+					if(other.has_value())
+						other.interface<iface::relocate>().function(other.data, data);
+					if(has_value())
+						interface<iface::relocate>().function(staged, other.data);
+					std::swap(vtable, other.vtable);
+					if(!has_value())
+						poison_data();
+					if(!other.has_value())
+						other.poison_data();
+				}
+				else
+				{
+					base_any tmp(std::move(other));
+					other = std::move(*this);
+					*this = std::move(tmp);
+				}
 			}
-			vtable = other.vtable;
-			return *this;
-		}
 
-		/// calls the given interface function of the inner object
-		template<typename Interface, typename... Args>
-		decltype(auto) call(Args&&... args)
-		{
-			static_assert(std::is_base_of<_any_detail::table_entry<Interface>, _any_detail::fn_table<Interfaces...>>::value,
-				"this any-object does not support given interface");
+			/// calls the given interface function of the inner object
+			template<typename Interface, typename... Args>
+			EXTANY_CONSTEXPR decltype(auto) call(Args&&... args)
+			{
+				static_assert(_any_detail::has_interface_v<Interface, Interfaces...>,
+					"this any-object does not support given interface");
 
-			return interface<Interface>().function(data, std::forward<Args>(args)...);
-		}
+				return interface<Interface>().function(data, std::forward<Args>(args)...);
+			}
 
-		/// calls the given interface function of the inner object
-		template<typename Interface, typename... Args>
-		decltype(auto) call(Args&&... args) const
-		{
-			static_assert(std::is_base_of<_any_detail::table_entry<Interface>, _any_detail::fn_table<Interfaces...>>::value,
-				"this any-object does not support given interface");
+			/// calls the given interface function of the inner object
+			template<typename Interface, typename... Args>
+			EXTANY_CONSTEXPR decltype(auto) call(Args&&... args) const
+			{
+				static_assert(_any_detail::has_interface_v<Interface, Interfaces...>,
+					"this any-object does not support given interface");
 
-			return interface<Interface>().function(data, std::forward<Args>(args)...);
-		}
+				return interface<Interface>().function(data, std::forward<Args>(args)...);
+			}
 
-		/// returns true if this any contains a value, false otherwise
-		bool has_value() const
-		{
-			return vtable != nullptr;
-		}
+			/// returns true if this any contains a value, false otherwise
+			EXTANY_CONSTEXPR bool has_value() const
+			{
+				assert(!destroyed() && "use of a destroyed any-object");
+				return vtable != nullptr;
+			}
 
 #ifndef EXT_NO_RTTI
-		auto type() const -> std::type_info const&
-		{
-			if(has_value())
-				return interface<iface::type_info>().function();
-			else
-				return typeid(void);
-		}
+			auto type() const -> std::type_info const&
+			{
+				if(has_value())
+					return interface<iface::type_info>().function();
+				else
+					return typeid(void);
+			}
 #endif
 
-		/// destroys the inner object (has_value() returns false afterwards)
-		void reset()
+			/// destroys the inner object (has_value() returns false afterwards)
+			void reset()
+			{
+				destroy();
+				vtable = nullptr;
+				poison_data();
+			}
+
+		private:
+			template<typename Interface>
+			EXTANY_CONSTEXPR decltype(auto) interface() const
+			{
+				assert(has_value());
+				return *static_cast<_any_detail::table_entry<Interface> const*>(vtable);
+			}
+
+			EXTANY_CONSTEXPR void destroy()
+			{
+#ifdef EXTANY_HAS_CONSTEXPR
+				// objects stored during constant evaluation are trivially copyable and thus trivially destructible
+				if(std::is_constant_evaluated())
+					return;
+#endif
+				if(has_value())
+					if(auto function = interface<iface::destroy>().function)
+						function(data);
+			}
+
+#ifdef EXTANY_HAS_CONSTEXPR
+			/// initializes all bytes of `data`, which constant evaluation requires
+			constexpr void clear_data()
+			{
+				for(std::size_t i = 0; i < size; ++i)
+					data[i] = 0;
+			}
+#endif
+
+			/// returns true if the inner object can be relocated without throwing
+			bool nothrow_relocatable() const
+			{
+				return !has_value() || interface<iface::relocate>().nothrow_relocate;
+			}
+
+			/// replaces the inner object with the one `construct` creates in the given storage
+			/**
+				Provides the strong exception guarantee: unless construction is known not to throw, the new
+				object is staged in temporary storage and relocated once the old object has been destroyed.
+				If the new type cannot be relocated without throwing, the old object is destroyed first and
+				a failed construction leaves this any-object empty.
+			*/
+			template<typename Construct>
+			void replace(_any_detail::vtable_t<Interfaces...> const* new_vtable, bool nothrow, Construct&& construct)
+			{
+				auto const& relocation = static_cast<_any_detail::table_entry<iface::relocate> const&>(*new_vtable);
+				if(has_value() && !nothrow && relocation.nothrow_relocate)
+				{
+					alignas(Alignment) char staged[size];
+					construct(staged);
+					destroy();
+					relocation.function(staged, data);
+				}
+				else
+				{
+					reset();
+					unpoison_data();
+					construct(data);
+				}
+				vtable = new_vtable;
+			}
+
+			/// marks `data` as unaddressable while it holds no object (EXTANY_CHECKED with AddressSanitizer)
+			EXTANY_CONSTEXPR void poison_data() const
+			{
+#ifdef EXTANY_ASAN_POISONING
+#ifdef EXTANY_HAS_CONSTEXPR
+				if(std::is_constant_evaluated())
+					return;
+#endif
+				ASAN_POISON_MEMORY_REGION(data, size);
+#endif
+			}
+
+			/// marks `data` as addressable before an object is constructed in it
+			EXTANY_CONSTEXPR void unpoison_data() const
+			{
+#ifdef EXTANY_ASAN_POISONING
+#ifdef EXTANY_HAS_CONSTEXPR
+				if(std::is_constant_evaluated())
+					return;
+#endif
+				ASAN_UNPOISON_MEMORY_REGION(data, size);
+#endif
+			}
+
+			/// points the function table pointer of a destroyed any-object to a sentinel (EXTANY_CHECKED)
+			/**
+				The storage is unpoisoned, as the memory may be reused for objects of other types, which
+				would not unpoison it.
+			*/
+			EXTANY_CONSTEXPR void mark_destroyed()
+			{
+#ifdef EXTANY_CHECKS
+#ifdef EXTANY_HAS_CONSTEXPR
+				if(std::is_constant_evaluated())
+					return;
+#endif
+				// the store must survive dead store elimination at the end of the lifetime
+				decltype(vtable) volatile& marker = vtable;
+				marker = _any_detail::destroyed_vtable<_any_detail::vtable_t<Interfaces...>>();
+				unpoison_data();
+#endif
+			}
+
+			/// returns true if this any-object has been destroyed, always false unless EXTANY_CHECKED
+			EXTANY_CONSTEXPR bool destroyed() const
+			{
+#ifdef EXTANY_CHECKS
+#ifdef EXTANY_HAS_CONSTEXPR
+				if(std::is_constant_evaluated())
+					return false;
+#endif
+				return vtable == _any_detail::destroyed_vtable<_any_detail::vtable_t<Interfaces...>>();
+#else
+				return false;
+#endif
+			}
+
+		private:
+			using storage_t::data;
+			using storage_t::vtable;
+		};
+	} // namespace EXTANY_INTERFACE_ORDER
+
+	namespace _any_detail
+	{
+		struct access
 		{
-			destroy();
-			vtable = nullptr;
-		}
+			/// returns the function table of the inner object, nullptr if empty
+			template<std::size_t Size, std::size_t Alignment, typename... Interfaces>
+			static constexpr vtable_t<Interfaces...> const* vtable(base_any<Size, Alignment, Interfaces...> const& a)
+			{
+				return a.vtable;
+			}
 
-	private:
-		template<typename Interface>
-		decltype(auto) interface() const
+			template<std::size_t Size, std::size_t Alignment, typename... Interfaces>
+			static char* data(base_any<Size, Alignment, Interfaces...>& a)
+			{
+				return a.data;
+			}
+
+			template<std::size_t Size, std::size_t Alignment, typename... Interfaces>
+			static constexpr char const* data(base_any<Size, Alignment, Interfaces...> const& a)
+			{
+				return a.data;
+			}
+
+			/// returns the integer identifying the type and interfaces of the inner object, zero if empty
+			template<std::size_t Size, std::size_t Alignment, typename... Interfaces>
+			static std::uintptr_t type_id(base_any<Size, Alignment, Interfaces...> const& a)
+			{
+				return typeid_by_vtable(a.vtable);
+			}
+		};
+
+		/// provides the integer identifying objects of type T in any-objects of type Any
+		template<typename T, typename Any>
+		struct type_id_of;
+
+		template<typename T, std::size_t Size, std::size_t Alignment, typename... Interfaces>
+		struct type_id_of<T, base_any<Size, Alignment, Interfaces...>>
 		{
-			assert(has_value());
-			return *static_cast<_any_detail::table_entry<Interface> const*>(vtable);
+			static std::uintptr_t value()
+			{
+				return typeid_by_type<std::decay_t<T>, Interfaces...>();
+			}
+		};
+	} // namespace _any_detail
+
+	inline namespace EXTANY_INTERFACE_ORDER
+	{
+		/// free-standing-function equivalent to base_any::swap()
+		template<std::size_t Size, std::size_t Alignment, typename... Interfaces>
+		void swap(base_any<Size, Alignment, Interfaces...>& lhs, base_any<Size, Alignment, Interfaces...>& rhs)
+		{
+			lhs.swap(rhs);
 		}
 
-		void destroy()
+		/// free-standing-function equivalent to base_any::has_value()
+		template<std::size_t Size, std::size_t Alignment, typename... Interfaces>
+		EXTANY_CONSTEXPR bool has_value(base_any<Size, Alignment, Interfaces...> const& a)
 		{
-			if(has_value())
-				interface<iface::destroy>().function(data);
+			return a.has_value();
 		}
 
-	private:
-		char data[size];
-		_any_detail::fn_table<
-			iface::destroy,
+		/// returns true if the given cast is valid
+		template<typename T, std::size_t Size, std::size_t Alignment, typename... Interfaces>
+		EXTANY_CONSTEXPR bool valid_cast(base_any<Size, Alignment, Interfaces...>& a)
+		{
+#ifdef EXTANY_HAS_CONSTEXPR
+			// there is only one function table per type during constant evaluation
+			if(std::is_constant_evaluated())
+				return a.vtable == &_any_detail::function_table<T, Interfaces...>;
+#endif
+			return _any_detail::typeid_by_vtable(a.vtable) == _any_detail::typeid_by_type<T, Interfaces...>()
 #ifndef EXT_NO_RTTI
-			iface::type_info,
+			       || a.type() == typeid(T)
 #endif
-			Interfaces...
-		> const* vtable;
-	};
-
-	/// free-standing-function equivalent to base_any::has_value()
-	template<std::size_t Size, std::size_t Alignment, typename... Interfaces>
-	bool has_value(base_any<Size, Alignment, Interfaces...> const& a)
-	{
-		return a.has_value();
-	}
+			;
+		}
 
-	/// returns true if the given cast is valid
-	template<typename T, std::size_t Size, std::size_t Alignment, typename... Interfaces>
-	bool valid_cast(base_any<Size, Alignment, Interfaces...>& a)
-	{
-		return _any_detail::typeid_by_vtable(a.vtable) == _any_detail::typeid_by_type<T, Interfaces...>()
+		/// returns true if the given cast is valid
+		template<typename T, std::size_t Size, std::size_t Alignment, typename... Interfaces>
+		EXTANY_CONSTEXPR bool valid_cast(base_any<Size, Alignment, Interfaces...> const& a)
+		{
+#ifdef EXTANY_HAS_CONSTEXPR
+			// there is only one function table per type during constant evaluation
+			if(std::is_constant_evaluated())
+				return a.vtable == &_any_detail::function_table<T, Interfaces...>;
+#endif
+			return _any_detail::typeid_by_vtable(a.vtable) == _any_detail::typeid_by_type<T, Interfaces...>()
 #ifndef EXT_NO_RTTI
-		       || a.type() == typeid(T)
+			       || a.type() == typeid(T)
 #endif
-		;
-	}
+			;
+		}
 
-	/// returns true if the given cast is valid
-	template<typename T, std::size_t Size, std::size_t Alignment, typename... Interfaces>
-	bool valid_cast(base_any<Size, Alignment, Interfaces...> const& a)
-	{
-		return _any_detail::typeid_by_vtable(a.vtable) == _any_detail::typeid_by_type<T, Interfaces...>()
-#ifndef EXT_NO_RTTI
-		       || a.type() == typeid(T)
+		/// returns a reference to the given type
+		/**
+			\note If the given any does not contain the given type, using the returned reference is undefined behavior
+			\see valid_cast
+		*/
+		template<typename T, std::size_t Size, std::size_t Alignment, typename... Interfaces>
+		T& any_cast(base_any<Size, Alignment, Interfaces...>& a)
+		{
+			assert(valid_cast<T>(a) && "any_cast: any-object does not contain given type");
+#ifdef EXTANY_CHECKS
+			assert(reinterpret_cast<std::uintptr_t>(a.data) % alignof(T) == 0 && "any_cast: misaligned any-object");
 #endif
-		;
-	}
+			return *reinterpret_cast<T*>(a.data);
+		}
 
-	/// returns a reference to the given type
-	/**
-		\note If the given any does not contain the given type, using the returned reference is undefined behavior
-		\see valid_cast
-	*/
-	template<typename T, std::size_t Size, std::size_t Alignment, typename... Interfaces>
-	T& any_cast(base_any<Size, Alignment, Interfaces...>& a)
-	{
-		assert(valid_cast<T>(a) && "any_cast: any-object does not contain given type");
-		return *reinterpret_cast<T*>(a.data);
-	}
+		/// returns a reference to the given type
+		/**
+			\note If the given any does not contain the given type, using the returned reference is undefined behavior
+			\see valid_cast
+		*/
+		template<typename T, std::size_t Size, std::size_t Alignment, typename... Interfaces>
+		T const& any_cast(base_any<Size, Alignment, Interfaces...> const& a)
+		{
+			assert(valid_cast<T>(a) && "any_cast: any-object does not contain given type");
+#ifdef EXTANY_CHECKS
+			assert(reinterpret_cast<std::uintptr_t>(a.data) % alignof(T) == 0 && "any_cast: misaligned any-object");
+#endif
+			return *reinterpret_cast<T const*>(a.data);
+		}
 
-	/// returns a reference to the given type
-	/**
-		\note If the given any does not contain the given type, using the returned reference is undefined behavior
-		\see valid_cast
-	*/
-	template<typename T, std::size_t Size, std::size_t Alignment, typename... Interfaces>
-	T const& any_cast(base_any<Size, Alignment, Interfaces...> const& a)
-	{
-		assert(valid_cast<T>(a) && "any_cast: any-object does not contain given type");
-		return *reinterpret_cast<T const*>(a.data);
-	}
+		/// returns a copy of the inner object
+		/**
+			Unlike any_cast, this function can be used in constant expressions (C++20), provided T is
+			trivially copyable.
+			\note If the given any does not contain the given type, the behavior is undefined
+			\see valid_cast
+		*/
+		template<typename T, std::size_t Size, std::size_t Alignment, typename... Interfaces>
+		EXTANY_CONSTEXPR T any_value_cast(base_any<Size, Alignment, Interfaces...> const& a)
+		{
+			assert(valid_cast<T>(a) && "any_value_cast: any-object does not contain given type");
+#ifdef EXTANY_HAS_CONSTEXPR
+			if constexpr(_any_detail::is_constexpr_storable_v<T>)
+				if(std::is_constant_evaluated())
+					return _any_detail::constexpr_load<T>(_any_detail::access::data(a));
+#endif
+			return any_cast<T>(a);
+		}
 
-	/// calls the given interface function of the any's inner object
-	/**
-		\note Calling this function on an empty any is undefined behavior
-		\see base_any::has_value
-	*/
-	template<typename Interface, std::size_t Size, std::size_t Alignment, typename... Interfaces, typename... Args>
-	decltype(auto) call(base_any<Size, Alignment, Interfaces...>& a, Args&&... args)
-	{
-		return a.template call<Interface>(std::forward<Args>(args)...);
-	}
+		/// calls the given interface function of the any's inner object
+		/**
+			\note Calling this function on an empty any is undefined behavior
+			\see base_any::has_value
+		*/
+		template<typename Interface, std::size_t Size, std::size_t Alignment, typename... Interfaces, typename... Args>
+		EXTANY_CONSTEXPR decltype(auto) call(base_any<Size, Alignment, Interfaces...>& a, Args&&... args)
+		{
+			return a.template call<Interface>(std::forward<Args>(args)...);
+		}
 
-	/// calls the given interface function of the any's inner object
-	/**
-		\note Calling this function on an empty any is undefined behavior
-		\see base_any::has_value
-	*/
-	template<typename Interface, std::size_t Size, std::size_t Alignment, typename... Interfaces, typename... Args>
-	decltype(auto) call(base_any<Size, Alignment, Interfaces...> const& a, Args&&... args)
-	{
-		return a.template call<Interface>(std::forward<Args>(args)...);
-	}
+		/// calls the given interface function of the any's inner object
+		/**
+			\note Calling this function on an empty any is undefined behavior
+			\see base_any::has_value
+		*/
+		template<typename Interface, std::size_t Size, std::size_t Alignment, typename... Interfaces, typename... Args>
+		EXTANY_CONSTEXPR decltype(auto) call(base_any<Size, Alignment, Interfaces...> const& a, Args&&... args)
+		{
+			return a.template call<Interface>(std::forward<Args>(args)...);
+		}
 
-	template<std::size_t Size, std::size_t Alignment = 8>
-	using any = base_any<Size, Alignment, iface::copy>;
+		template<std::size_t Size, std::size_t Alignment = 8>
+		using any = base_any<Size, Alignment, iface::copy>;
+	} // namespace EXTANY_INTERFACE_ORDER
 } // namespace any
 
 #endif // EXT_ANY_HEADER
@@ -0,0 +1,258 @@
+#ifndef EXT_ANY_AWAITABLE_HEADER
+#define EXT_ANY_AWAITABLE_HEADER
+
+#include <ext/any.hpp>
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#define EXTANY_HAS_COROUTINES
+
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+
+namespace ext
+{
+	namespace iface
+	{
+		/// awaitable interface definition, requires `bool await_ready()`
+		struct await_ready
+		{
+			using signature_t = bool(placeholder&);
+
+			template<typename Awaitable>
+			static bool invoke(Awaitable& awaitable)
+			{
+				return awaitable.await_ready();
+			}
+		};
+
+		/// awaitable interface definition, requires `await_suspend(std::coroutine_handle<>)`
+		/**
+			The result of `await_suspend` is normalized to the coroutine to resume next: `void` and
+			`true` resume nothing (`std::noop_coroutine()`), `false` resumes the awaiting coroutine.
+		*/
+		struct await_suspend
+		{
+			using signature_t = std::coroutine_handle<>(placeholder&, std::coroutine_handle<>);
+
+			template<typename Awaitable>
+			static std::coroutine_handle<> invoke(Awaitable& awaitable, std::coroutine_handle<> awaiting)
+			{
+				using result_t = decltype(awaitable.await_suspend(awaiting));
+				if constexpr(std::is_void<result_t>::value)
+				{
+					awaitable.await_suspend(awaiting);
+					return std::noop_coroutine();
+				}
+				else if constexpr(std::is_same<result_t, bool>::value)
+					return awaitable.await_suspend(awaiting) ? std::noop_coroutine() : awaiting;
+				else
+					return awaitable.await_suspend(awaiting);
+			}
+		};
+
+		/// awaitable interface definition, requires `Result await_resume()`
+		template<typename Result>
+		struct await_resume
+		{
+			using signature_t = Result(placeholder&);
+
+			template<typename Awaitable>
+			static Result invoke(Awaitable& awaitable)
+			{
+				return awaitable.await_resume();
+			}
+		};
+	} // namespace iface
+
+	/// awaitable holding any awaitable with a result convertible to `Result` inline
+	/**
+		Awaiting it costs one indirect call per step of the await protocol and no allocation.
+
+		\code{.cpp}
+		ext::any_awaitable<32, int> next = use_timer ? ext::any_awaitable<32, int>{timer{10ms}}
+		                                             : ext::any_awaitable<32, int>{read{socket}};
+		int result = co_await next;
+		\endcode
+
+		\note The inner awaitable receives the awaiting coroutine as `std::coroutine_handle<>`,
+		      awaitables requiring the handle of a specific promise type cannot be stored.
+	*/
+	template<std::size_t Size, typename Result = void, std::size_t Alignment = 8>
+	class any_awaitable
+	{
+	public:
+		using result_type = Result;
+		using awaitable_type =
+			base_any<Size, Alignment, iface::move, iface::await_ready, iface::await_suspend, iface::await_resume<Result>>;
+
+		template<
+			typename Awaitable,
+			typename = std::enable_if_t<!std::is_same<std::decay_t<Awaitable>, any_awaitable>::value>
+		>
+		any_awaitable(Awaitable&& awaitable)
+			: awaitable(std::forward<Awaitable>(awaitable))
+		{ }
+
+		any_awaitable(any_awaitable&&) = default;
+		any_awaitable& operator=(any_awaitable&&) = default;
+
+		bool await_ready()
+		{
+			return awaitable.template call<iface::await_ready>();
+		}
+
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting)
+		{
+			return awaitable.template call<iface::await_suspend>(awaiting);
+		}
+
+		Result await_resume()
+		{
+			return awaitable.template call<iface::await_resume<Result>>();
+		}
+
+	private:
+		awaitable_type awaitable;
+	};
+
+	/// single-threaded scheduler resuming coroutines in the order they were posted
+	/**
+		\code{.cpp}
+		ext::any_scheduler scheduler;
+		scheduler.spawn([](ext::any_scheduler& s) -> ext::any_scheduler::task {
+			co_await s.yield();
+		}(scheduler));
+		scheduler.run();
+		\endcode
+
+		The scheduler owns the coroutines passed to spawn() until they complete and destroys the
+		unfinished ones with itself, also those suspended on other awaitables. Coroutines passed
+		to post() or awaiting yield() are only resumed, they remain owned by their caller and have
+		to stay alive until resumed or until the scheduler is destroyed.
+	*/
+	class any_scheduler
+	{
+	public:
+		/// detached coroutine, which starts once spawned and destroys itself when it completes
+		class task
+		{
+		public:
+			struct promise_type
+			{
+				any_scheduler* scheduler = nullptr; // set once spawned
+
+				~promise_type()
+				{
+					if(scheduler != nullptr)
+						scheduler->owned.erase(std::coroutine_handle<promise_type>::from_promise(*this).address());
+				}
+
+				task get_return_object()
+				{
+					return task{std::coroutine_handle<promise_type>::from_promise(*this)};
+				}
+
+				std::suspend_always initial_suspend() noexcept { return {}; }
+				std::suspend_never final_suspend() noexcept { return {}; }
+				void return_void() { }
+				void unhandled_exception() { std::terminate(); }
+			};
+
+			task(task&& other) noexcept
+				: handle(std::exchange(other.handle, nullptr))
+			{ }
+
+			task& operator=(task&&) = delete;
+
+			~task()
+			{
+				if(handle)
+					handle.destroy();
+			}
+
+		private:
+			friend class any_scheduler;
+
+			explicit task(std::coroutine_handle<promise_type> handle)
+				: handle(handle)
+			{ }
+
+			std::coroutine_handle<promise_type> handle;
+		};
+
+		/// awaitable resuming the awaiting coroutine after all coroutines posted before
+		struct yield_awaitable
+		{
+			any_scheduler& scheduler;
+
+			bool await_ready() const noexcept { return false; }
+			void await_suspend(std::coroutine_handle<> awaiting) const { scheduler.post(awaiting); }
+			void await_resume() const noexcept { }
+		};
+
+		any_scheduler() = default;
+		any_scheduler(any_scheduler const&) = delete;
+		any_scheduler& operator=(any_scheduler const&) = delete;
+
+		/// destroys the spawned tasks which have not completed, coroutines only posted are left to their owners
+		~any_scheduler()
+		{
+			auto unfinished = std::move(owned);
+			owned.clear();
+			for(void* frame : unfinished)
+				std::coroutine_handle<>::from_address(frame).destroy();
+		}
+
+		/// takes ownership of `t` and schedules it to start
+		void spawn(task t)
+		{
+			auto handle = std::exchange(t.handle, nullptr);
+			handle.promise().scheduler = this;
+			owned.insert(handle.address());
+			post(handle);
+		}
+
+		/// schedules `handle` to be resumed, without taking ownership
+		void post(std::coroutine_handle<> handle)
+		{
+			ready.push_back(handle);
+		}
+
+		yield_awaitable yield()
+		{
+			return {*this};
+		}
+
+		/// resumes coroutines until none is ready, returns the number of resumptions
+		std::size_t run()
+		{
+			std::size_t resumed = 0;
+			while(!ready.empty())
+			{
+				auto handle = ready.front();
+				ready.pop_front();
+				handle.resume();
+				++resumed;
+			}
+			return resumed;
+		}
+
+		/// returns true if no coroutine is ready to be resumed
+		bool empty() const
+		{
+			return ready.empty();
+		}
+
+	private:
+		std::deque<std::coroutine_handle<>> ready;
+		std::unordered_set<void*> owned; // frames of the spawned tasks which have not completed
+	};
+} // namespace ext
+
+#endif // coroutines
+#endif // EXT_ANY_AWAITABLE_HEADER
@@ -0,0 +1,336 @@
+#ifndef EXT_ANY_EVENT_BUS_HEADER
+#define EXT_ANY_EVENT_BUS_HEADER
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <ext/any.hpp>
+
+namespace ext
+{
+	/// routes any-objects to the handlers subscribed to the type of their inner object
+	/**
+		Messages are routed by the address of their function table, which is a single
+		hash lookup. Handlers are kept in one flat array, grouped by message type.
+
+		\code{.cpp}
+		ext::any_event_bus<ext::any<32>> bus;
+		bus.subscribe<key_pressed>([](key_pressed const& event) { ... });
+		bus.publish(key_pressed{'a'});
+		\endcode
+
+		Handlers may publish messages. Subscriptions made by handlers take effect once the outermost
+		publish returns, so they do not receive the message being delivered.
+
+		\note The function table identifies the type together with the interfaces of `Any`.
+		      Messages created in a different shared library may use a different table
+		      (e.g. with hidden symbol visibility) and will not be routed.
+	*/
+	template<typename Any, std::size_t HandlerSize = 32>
+	class any_event_bus
+	{
+		static_assert(is_any_v<Any>, "messages must be any-objects");
+
+		/// delivers a message to a handler
+		struct deliver
+		{
+			using signature_t = void(iface::placeholder&, Any const&);
+
+			template<typename Handler>
+			static void invoke(Handler& handler, Any const& message)
+			{
+				handler(message);
+			}
+		};
+
+		/// delivers a run of messages of the same type to a handler
+		struct deliver_run
+		{
+			using signature_t = void(iface::placeholder&, Any const* const*, std::size_t);
+
+			template<typename Handler>
+			static void invoke(Handler& handler, Any const* const* messages, std::size_t count)
+			{
+				handler.run(messages, count);
+			}
+		};
+
+		/// unwraps the message before invoking the subscribed function
+		template<typename T, typename Function>
+		struct typed_handler
+		{
+			Function function;
+
+			void operator()(Any const& message)
+			{
+				function(any_cast<T>(message));
+			}
+
+			void run(Any const* const* messages, std::size_t count)
+			{
+				for(std::size_t i = 0; i < count; ++i)
+					function(any_cast<T>(*messages[i]));
+			}
+		};
+
+		// handlers are copyable like the std::function they replace, vector growth copies them
+		using handler_t = base_any<HandlerSize, alignof(std::max_align_t), iface::copy, iface::move, deliver, deliver_run>;
+
+		/// hash table entry, locating the handlers of one message type
+		struct slot
+		{
+			std::uintptr_t type_id;
+			std::size_t first;
+			std::size_t count;
+		};
+
+		/// subscription made during dispatch, applied once the outermost publish returns
+		struct pending_subscription
+		{
+			std::uintptr_t type_id;
+			handler_t handler;
+		};
+
+		/// buffers reused by publish_batch
+		struct batch_scratch
+		{
+			std::vector<Any const*> order;
+			std::vector<std::size_t> slot_of;
+			std::vector<std::size_t> offsets;
+		};
+
+		/// marks the bus as dispatching while handlers run
+		struct dispatch_guard
+		{
+			explicit dispatch_guard(any_event_bus& bus)
+				: bus(bus)
+			{
+				++bus.depth;
+			}
+
+			~dispatch_guard()
+			{
+				--bus.depth;
+			}
+
+			any_event_bus& bus;
+		};
+
+	public:
+		using message_type = Any;
+
+		/// registers `handler` to be called with every published message of type T
+		template<typename T, typename Handler>
+		void subscribe(Handler&& handler)
+		{
+			using typed_handler_t = typed_handler<std::decay_t<T>, std::decay_t<Handler>>;
+
+			std::uintptr_t type_id = _any_detail::type_id_of<T, Any>::value();
+			handler_t erased{typed_handler_t{std::forward<Handler>(handler)}};
+			if(depth != 0)
+			{
+				// inserting now would move the handlers which are running
+				pending.push_back(pending_subscription{type_id, std::move(erased)});
+				return;
+			}
+
+			apply_pending();
+			insert_handler(type_id, std::move(erased));
+		}
+
+		/// calls all handlers subscribed to the type of `message`
+		void publish(Any const& message)
+		{
+			{
+				dispatch_guard guard(*this);
+				slot const* found = find(_any_detail::access::type_id(message));
+				if(found != nullptr)
+					for(std::size_t i = found->first; i < found->first + found->count; ++i)
+						handlers[i].template call<deliver>(message);
+			}
+			apply_pending();
+		}
+
+		/// delivers a batch of messages grouped by type
+		/**
+			Each handler receives the messages of its type in their order within the batch, but
+			messages of different types are not delivered in batch order. A handler is called once
+			per batch through its function table and loops over its messages with the message type
+			known. This gains over calling publish for each message when message types are mixed
+			unpredictably; for long runs of one type or a short repeating type pattern, the CPU
+			predicts the calls of publish and grouping costs more than it saves.
+		*/
+		void publish_batch(std::vector<Any> const& messages)
+		{
+			{
+				dispatch_guard guard(*this);
+				// handlers publishing batches themselves find the spare buffers taken and use new ones
+				batch_scratch scratch = std::move(spare);
+				group_by_slot(messages, scratch);
+
+				// offsets[i] now is the end of the run of slot i
+				std::size_t run = 0;
+				for(std::size_t i = 0; i < slots.size(); ++i)
+				{
+					std::size_t end = scratch.offsets[i];
+					for(std::size_t h = slots[i].first; run != end && h < slots[i].first + slots[i].count; ++h)
+						handlers[h].template call<deliver_run>(scratch.order.data() + run, end - run);
+					run = end;
+				}
+				spare = std::move(scratch);
+			}
+			apply_pending();
+		}
+
+		/// returns the number of handlers subscribed to messages of type T
+		template<typename T>
+		std::size_t subscriber_count() const
+		{
+			slot const* found = find(_any_detail::type_id_of<T, Any>::value());
+			return found ? found->count : 0;
+		}
+
+		/// removes all handlers
+		/**
+			\note Must not be called by handlers.
+		*/
+		void clear()
+		{
+			assert(depth == 0 && "any_event_bus: clear() called during dispatch");
+			pending.clear();
+			slots.clear();
+			handlers.clear();
+			used = 0;
+		}
+
+	private:
+		/// counting sort of the messages by slot, messages without handlers use the extra last slot
+		void group_by_slot(std::vector<Any> const& messages, batch_scratch& scratch) const
+		{
+			std::size_t const unhandled = slots.size();
+			scratch.offsets.assign(slots.size() + 2, 0);
+			scratch.slot_of.resize(messages.size());
+			scratch.order.resize(messages.size());
+
+			// runs of messages of the same type share one lookup, empty messages have type id zero
+			std::uintptr_t last_type = 0;
+			std::size_t last_slot = unhandled;
+			for(std::size_t i = 0; i < messages.size(); ++i)
+			{
+				std::uintptr_t type_id = _any_detail::access::type_id(messages[i]);
+				if(type_id != last_type)
+				{
+					slot const* found = find(type_id);
+					last_type = type_id;
+					last_slot = found ? static_cast<std::size_t>(found - slots.data()) : unhandled;
+				}
+				scratch.slot_of[i] = last_slot;
+				++scratch.offsets[last_slot + 1];
+			}
+
+			for(std::size_t i = 1; i < scratch.offsets.size(); ++i)
+				scratch.offsets[i] += scratch.offsets[i - 1];
+
+			for(std::size_t i = 0; i < messages.size(); ++i)
+				scratch.order[scratch.offsets[scratch.slot_of[i]]++] = &messages[i];
+		}
+
+		/// appends `handler` to the handlers of the given type
+		void insert_handler(std::uintptr_t type_id, handler_t&& handler)
+		{
+			slot& target = slot_for(type_id);
+			std::size_t position = target.first + target.count;
+			handlers.insert(handlers.begin() + static_cast<std::ptrdiff_t>(position), std::move(handler));
+			++target.count;
+
+			for(slot& other : slots)
+				if(other.type_id != 0 && &other != &target && other.first >= position)
+					++other.first;
+		}
+
+		/// applies the subscriptions made during dispatch, unless still dispatching
+		void apply_pending()
+		{
+			if(depth != 0 || pending.empty())
+				return;
+
+			std::vector<pending_subscription> applied;
+			applied.swap(pending);
+			for(auto& subscription : applied)
+				insert_handler(subscription.type_id, std::move(subscription.handler));
+		}
+
+		std::size_t index_of(std::uintptr_t type_id) const
+		{
+			// fibonacci hashing, function tables are at least pointer aligned
+			return static_cast<std::size_t>((static_cast<std::uint64_t>(type_id) * 0x9E3779B97F4A7C15ull) >> shift);
+		}
+
+		/// returns the slot for the given type or nullptr if there is none
+		slot const* find(std::uintptr_t type_id) const
+		{
+			if(type_id == 0 || slots.empty())
+				return nullptr;
+
+			std::size_t mask = slots.size() - 1;
+			for(std::size_t i = index_of(type_id);; i = (i + 1) & mask)
+			{
+				if(slots[i].type_id == type_id)
+					return &slots[i];
+				if(slots[i].type_id == 0)
+					return nullptr;
+			}
+		}
+
+		/// returns the slot for the given type, inserting it if there is none
+		slot& slot_for(std::uintptr_t type_id)
+		{
+			if(slot const* found = find(type_id))
+				return slots[found - slots.data()];
+
+			if(2 * (used + 1) > slots.size())
+				rehash(slots.empty() ? 8 : 2 * slots.size());
+
+			++used;
+			return insert(slot{type_id, handlers.size(), 0});
+		}
+
+		slot& insert(slot const& entry)
+		{
+			std::size_t mask = slots.size() - 1;
+			std::size_t i = index_of(entry.type_id);
+			while(slots[i].type_id != 0)
+				i = (i + 1) & mask;
+			return slots[i] = entry;
+		}
+
+		void rehash(std::size_t capacity)
+		{
+			std::vector<slot> old(capacity, slot{0, 0, 0});
+			old.swap(slots);
+
+			shift = 64;
+			for(std::size_t i = capacity; i > 1; i >>= 1)
+				--shift;
+
+			for(slot const& entry : old)
+				if(entry.type_id != 0)
+					insert(entry);
+		}
+
+		std::vector<slot> slots;
+		std::vector<handler_t> handlers;
+		std::vector<pending_subscription> pending;
+		batch_scratch spare;
+		std::size_t depth = 0;
+		std::size_t used = 0;
+		unsigned shift = 64;
+	};
+} // namespace ext
+
+#endif // EXT_ANY_EVENT_BUS_HEADER
@@ -0,0 +1,241 @@
+#ifndef EXT_ANY_POOL_HEADER
+#define EXT_ANY_POOL_HEADER
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include <ext/any.hpp>
+
+namespace ext
+{
+	/// statistics of an any_pool
+	struct any_pool_stats
+	{
+		/// number of any-objects created
+		std::size_t creates = 0;
+		/// number of batches threads took from the global free list
+		std::size_t refills = 0;
+		/// number of slots allocated from the system
+		std::size_t capacity = 0;
+		/// highest number of slots held by threads at once, in use or cached
+		std::size_t high_water = 0;
+
+		/// fraction of creations served from the free list of the calling thread
+		double hit_rate() const
+		{
+			return creates == 0 ? 0.0 : 1.0 - static_cast<double>(std::min(refills, creates)) / static_cast<double>(creates);
+		}
+	};
+
+	namespace _any_detail
+	{
+		/// storage for one pooled any-object, linking the free list while unused
+		template<typename Any>
+		union pool_slot
+		{
+			pool_slot* next;
+			alignas(Any) unsigned char bytes[sizeof(Any)];
+		};
+	} // namespace _any_detail
+
+	/// allocates any-objects of type Any from per-thread free lists
+	/**
+		Every thread keeps a free list of slots. Slots move between the threads and a global free
+		list `BatchSize` at a time, so only every `BatchSize`-th creation or destruction takes a
+		lock. Slots are never returned to the system before the program exits.
+
+		\code{.cpp}
+		using pool_t = ext::any_pool<ext::any<256>>;
+		ext::any<256>* node = pool_t::create(large_payload{});
+		...
+		pool_t::destroy(node);
+		\endcode
+
+		\note All objects have to be destroyed before the program exits. Objects may be destroyed
+		      by a different thread than the one creating them.
+	*/
+	template<typename Any, std::size_t BatchSize = 64>
+	class any_pool
+	{
+		static_assert(is_any_v<Any>, "any_pool allocates any-objects");
+		static_assert(BatchSize > 0, "batch size must not be zero");
+
+		using slot = _any_detail::pool_slot<Any>;
+
+		/// a chain of free slots
+		struct batch
+		{
+			slot* head;
+			std::size_t count;
+		};
+
+		/// global free list, shared by all threads
+		struct global_list
+		{
+			std::mutex mutex;
+			std::vector<batch> batches;
+			std::vector<slot*> blocks;
+			any_pool_stats stats;
+			std::size_t outstanding = 0;
+
+			~global_list()
+			{
+				for(slot* block : blocks)
+					::operator delete(block, std::align_val_t(alignof(slot)));
+			}
+
+			/// hands a batch to a thread, allocating a new block if none is free
+			batch take(std::size_t creates)
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				stats.creates += creates;
+				++stats.refills;
+
+				batch result;
+				if(batches.empty())
+				{
+					slot* block = static_cast<slot*>(::operator new(sizeof(slot) * BatchSize, std::align_val_t(alignof(slot))));
+					blocks.push_back(block);
+					for(std::size_t i = 0; i + 1 < BatchSize; ++i)
+						block[i].next = &block[i + 1];
+					block[BatchSize - 1].next = nullptr;
+					stats.capacity += BatchSize;
+					result = batch{block, BatchSize};
+				}
+				else
+				{
+					result = batches.back();
+					batches.pop_back();
+				}
+
+				outstanding += result.count;
+				stats.high_water = std::max(stats.high_water, outstanding);
+				return result;
+			}
+
+			/// takes back a batch from a thread
+			void give(batch returned, std::size_t creates)
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				stats.creates += creates;
+				if(returned.count == 0)
+					return;
+				outstanding -= returned.count;
+				batches.push_back(returned);
+			}
+		};
+
+		static global_list& global()
+		{
+			static global_list instance;
+			return instance;
+		}
+
+		/// free list of the calling thread
+		struct local_list
+		{
+			slot* head = nullptr;
+			std::size_t count = 0;
+			std::size_t creates = 0; // not yet reported to the global statistics
+			global_list& shared = global();
+
+			~local_list()
+			{
+				shared.give(batch{head, count}, creates);
+			}
+
+			slot* pop()
+			{
+				if(head == nullptr)
+				{
+					batch refill = shared.take(creates);
+					head = refill.head;
+					count = refill.count;
+					creates = 0;
+				}
+				slot* result = head;
+				head = head->next;
+				--count;
+				++creates;
+				return result;
+			}
+
+			void push(slot* freed)
+			{
+				freed->next = head;
+				head = freed;
+				++count;
+
+				if(count >= 2 * BatchSize)
+				{
+					// keep BatchSize slots, return the others
+					slot* last = head;
+					for(std::size_t i = 1; i < BatchSize; ++i)
+						last = last->next;
+					batch returned{last->next, count - BatchSize};
+					last->next = nullptr;
+					count = BatchSize;
+					shared.give(returned, creates);
+					creates = 0;
+				}
+			}
+		};
+
+		static local_list& local()
+		{
+			thread_local local_list instance;
+			return instance;
+		}
+
+	public:
+		using value_type = Any;
+		constexpr static std::size_t batch_size = BatchSize;
+
+		/// constructs an any-object from `args` in a pooled slot
+		template<typename... Args>
+		static Any* create(Args&&... args)
+		{
+			local_list& list = local();
+			slot* target = list.pop();
+			try
+			{
+				return new(target->bytes) Any(std::forward<Args>(args)...);
+			}
+			catch(...)
+			{
+				list.push(target);
+				throw;
+			}
+		}
+
+		/// destroys an any-object created by this pool and recycles its slot
+		/**
+			The inner object is not called for destruction if it is trivially destructible.
+		*/
+		static void destroy(Any* object)
+		{
+			if(object == nullptr)
+				return;
+			object->~Any();
+			local().push(reinterpret_cast<slot*>(reinterpret_cast<unsigned char*>(object)));
+		}
+
+		/// returns the statistics of this pool
+		/**
+			Threads report their creations when they exchange batches with the global free list,
+			so recent creations may be missing.
+		*/
+		static any_pool_stats stats()
+		{
+			global_list& shared = global();
+			std::lock_guard<std::mutex> lock(shared.mutex);
+			return shared.stats;
+		}
+	};
+} // namespace ext
+
+#endif // EXT_ANY_POOL_HEADER
@@ -0,0 +1,201 @@
+#ifndef EXT_ANY_RANGE_HEADER
+#define EXT_ANY_RANGE_HEADER
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <ext/any.hpp>
+
+namespace ext
+{
+	namespace iface
+	{
+		/// chunked element source interface definition
+		/**
+			Requires objects to provide a member function `std::size_t next(T* out, std::size_t count)`,
+			which writes up to `count` elements to `out` and returns the number of elements written.
+			Returning zero signals the end of the sequence.
+		*/
+		template<typename T>
+		struct next_chunk
+		{
+			using signature_t = std::size_t(placeholder&, T*, std::size_t);
+
+			template<typename Source>
+			static std::size_t invoke(Source& source, T* out, std::size_t count)
+			{
+				return source.next(out, count);
+			}
+		};
+	} // namespace iface
+
+	namespace _any_detail
+	{
+		/// chunked element source reading from an iterator/sentinel pair
+		template<typename Iterator, typename Sentinel>
+		struct iterator_source
+		{
+			Iterator current;
+			Sentinel last;
+
+			template<typename T>
+			std::size_t next(T* out, std::size_t count)
+			{
+				std::size_t n = 0;
+				for(; n < count && current != last; ++n, ++current)
+					out[n] = *current;
+				return n;
+			}
+		};
+	} // namespace _any_detail
+
+	/// input range over any source satisfying `iface::next_chunk<T>`
+	/**
+		Elements are pulled from the type-erased source `ChunkSize` at a time into an internal buffer,
+		so iterating the range costs one indirect call per chunk instead of one per element.
+
+		\code{.cpp}
+		ext::any_range<int, 32> range = my_generator{};
+		for(int value : range)
+			consume(value);
+		\endcode
+
+		\note Like other input ranges, an any_range can be traversed once. Moving the range
+		      invalidates its iterators.
+	*/
+	template<typename T, std::size_t Size, std::size_t Alignment = 8, std::size_t ChunkSize = 64>
+	class any_range
+	{
+		static_assert(ChunkSize > 0, "chunk size must not be zero");
+		static_assert(std::is_default_constructible<T>::value, "elements are buffered and must be default constructible");
+
+	public:
+		using value_type = T;
+		using source_type = base_any<Size, Alignment, iface::move, iface::next_chunk<T>>;
+		constexpr static std::size_t chunk_size = ChunkSize;
+
+		/// input iterator over the elements of an any_range
+		class iterator
+		{
+		public:
+			using iterator_category = std::input_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using pointer = T*;
+			using reference = T&;
+
+			/// holds a copy of the element an iterator pointed to before being incremented
+			struct postfix_proxy
+			{
+				T value;
+
+				T& operator*()
+				{
+					return value;
+				}
+			};
+
+			iterator() = default;
+
+			reference operator*() const
+			{
+				return range->buffer[range->position];
+			}
+
+			pointer operator->() const
+			{
+				return &range->buffer[range->position];
+			}
+
+			iterator& operator++()
+			{
+				if(++range->position == range->count && !range->refill())
+					range = nullptr;
+				return *this;
+			}
+
+			postfix_proxy operator++(int)
+			{
+				postfix_proxy proxy{std::move(**this)};
+				++*this;
+				return proxy;
+			}
+
+			friend bool operator==(iterator const& lhs, iterator const& rhs)
+			{
+				return lhs.range == rhs.range;
+			}
+
+			friend bool operator!=(iterator const& lhs, iterator const& rhs)
+			{
+				return lhs.range != rhs.range;
+			}
+
+		private:
+			friend class any_range;
+
+			explicit iterator(any_range* range)
+				: range(range)
+			{ }
+
+			any_range* range = nullptr;
+		};
+
+		any_range() = default;
+
+		template<
+			typename Source,
+			typename = std::enable_if_t<!std::is_same<std::decay_t<Source>, any_range>::value>
+		>
+		any_range(Source&& source)
+			: source(std::forward<Source>(source))
+		{ }
+
+		any_range(any_range&&) = default;
+		any_range& operator=(any_range&&) = default;
+
+		any_range(any_range const&) = delete;
+		any_range& operator=(any_range const&) = delete;
+
+		/// returns an iterator to the next unconsumed element
+		iterator begin()
+		{
+			if(position == count && !refill())
+				return iterator{};
+			return iterator{this};
+		}
+
+		iterator end()
+		{
+			return iterator{};
+		}
+
+	private:
+		/// pulls the next chunk from the source, returns false if the source is exhausted
+		bool refill()
+		{
+			position = 0;
+			count = source.has_value() ? source.template call<iface::next_chunk<T>>(buffer, ChunkSize) : 0;
+			return count != 0;
+		}
+
+		source_type source;
+		std::size_t position = 0;
+		std::size_t count = 0;
+		T buffer[ChunkSize];
+	};
+
+	/// creates an any_range reading the elements in [first, last)
+	template<
+		typename T, std::size_t Size, std::size_t Alignment = 8, std::size_t ChunkSize = 64,
+		typename Iterator, typename Sentinel
+	>
+	any_range<T, Size, Alignment, ChunkSize> make_any_range(Iterator first, Sentinel last)
+	{
+		return _any_detail::iterator_source<Iterator, Sentinel>{std::move(first), std::move(last)};
+	}
+} // namespace ext
+
+#endif // EXT_ANY_RANGE_HEADER
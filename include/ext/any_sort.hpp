@@ -0,0 +1,246 @@
+#ifndef EXT_ANY_SORT_HEADER
+#define EXT_ANY_SORT_HEADER
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include <ext/any.hpp>
+
+namespace ext
+{
+	namespace iface
+	{
+		/// ordering interface definition
+		/**
+			Use this interface to require objects to be ordered by `operator<`. Any-objects holding
+			different types are ordered by type, see any_less.
+			\note This is a special interface and is therefore incomplete.
+			      See documentation for how to implement custom interfaces.
+		*/
+		struct less
+		{
+			using signature_t = bool(placeholder const&, placeholder const&);
+		};
+	} // namespace iface
+
+	namespace _any_detail
+	{
+		/// random access iterator over objects of type T which are `stride` bytes apart
+		template<typename T>
+		class strided_iterator
+		{
+		public:
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using pointer = T*;
+			using reference = T&;
+
+			strided_iterator() = default;
+
+			strided_iterator(char* position, std::size_t stride)
+				: position(position)
+				, stride(static_cast<difference_type>(stride))
+			{ }
+
+			reference operator*() const { return *reinterpret_cast<T*>(position); }
+			pointer operator->() const { return reinterpret_cast<T*>(position); }
+			reference operator[](difference_type n) const { return *reinterpret_cast<T*>(position + n * stride); }
+
+			strided_iterator& operator++() { position += stride; return *this; }
+			strided_iterator& operator--() { position -= stride; return *this; }
+			strided_iterator operator++(int) { auto old = *this; position += stride; return old; }
+			strided_iterator operator--(int) { auto old = *this; position -= stride; return old; }
+
+			strided_iterator& operator+=(difference_type n) { position += n * stride; return *this; }
+			strided_iterator& operator-=(difference_type n) { position -= n * stride; return *this; }
+
+			friend strided_iterator operator+(strided_iterator it, difference_type n) { return it += n; }
+			friend strided_iterator operator+(difference_type n, strided_iterator it) { return it += n; }
+			friend strided_iterator operator-(strided_iterator it, difference_type n) { return it -= n; }
+			friend difference_type operator-(strided_iterator const& lhs, strided_iterator const& rhs)
+			{
+				return (lhs.position - rhs.position) / lhs.stride;
+			}
+
+			friend bool operator==(strided_iterator const& lhs, strided_iterator const& rhs) { return lhs.position == rhs.position; }
+			friend bool operator!=(strided_iterator const& lhs, strided_iterator const& rhs) { return lhs.position != rhs.position; }
+			friend bool operator<(strided_iterator const& lhs, strided_iterator const& rhs) { return lhs.position < rhs.position; }
+			friend bool operator>(strided_iterator const& lhs, strided_iterator const& rhs) { return lhs.position > rhs.position; }
+			friend bool operator<=(strided_iterator const& lhs, strided_iterator const& rhs) { return lhs.position <= rhs.position; }
+			friend bool operator>=(strided_iterator const& lhs, strided_iterator const& rhs) { return lhs.position >= rhs.position; }
+
+		private:
+			char* position = nullptr;
+			difference_type stride = 0;
+		};
+
+		/// interface function dispatcher for `iface::less`
+		template<>
+		struct dispatch_impl<iface::less, bool(iface::placeholder const&, iface::placeholder const&)>
+		{
+			using function_t = bool(*)(char const*, char const*);
+			using sort_t = void(*)(char*, std::size_t, std::size_t);
+
+			/// compares two objects of type T
+			template<typename T>
+			static bool invoke_interface(char const* lhs, char const* rhs)
+			{
+				return *reinterpret_cast<T const*>(lhs) < *reinterpret_cast<T const*>(rhs);
+			}
+
+			/// sorts `count` objects of type T which are `stride` bytes apart, starting at `first`
+			template<typename T>
+			static void sort(char* first, std::size_t count, std::size_t stride)
+			{
+				strided_iterator<T> begin(first, stride);
+				std::sort(begin, begin + static_cast<std::ptrdiff_t>(count));
+			}
+		};
+
+		/// function table entry for `iface::less`
+		/**
+			Additionally holds a sort kernel for the type, so that sorting any-objects holding the
+			same type needs a single indirect call.
+		*/
+		template<>
+		struct table_entry<iface::less>
+		{
+			dispatch<iface::less>::function_t function;
+			dispatch<iface::less>::sort_t sort;
+
+			template<typename T>
+			static constexpr table_entry make()
+			{
+				return {dispatch<iface::less>::invoke_interface<T>, dispatch<iface::less>::sort<T>};
+			}
+		};
+
+		template<typename Any>
+		table_entry<iface::less> const& less_entry(Any const& a)
+		{
+			return *static_cast<table_entry<iface::less> const*>(access::vtable(a));
+		}
+
+		/// groups the any-objects in [first, last) by type, returns the offsets of the groups
+		/**
+			Groups are ordered by type id, so empty any-objects come first. Objects are moved
+			between groups with swap, which relocates them where possible.
+		*/
+		template<typename Any>
+		std::vector<std::size_t> partition_by_type(Any* first, Any* last)
+		{
+			std::size_t const count = static_cast<std::size_t>(last - first);
+
+			std::vector<std::uintptr_t> types(count);
+			for(std::size_t i = 0; i < count; ++i)
+				types[i] = access::type_id(first[i]);
+
+			std::vector<std::uintptr_t> distinct(types);
+			std::sort(distinct.begin(), distinct.end());
+			distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+
+			// replace type ids by group indices and count the group sizes
+			std::vector<std::size_t> offsets(distinct.size() + 1, 0);
+			for(auto& type : types)
+			{
+				type = static_cast<std::uintptr_t>(std::lower_bound(distinct.begin(), distinct.end(), type) - distinct.begin());
+				++offsets[type + 1];
+			}
+			for(std::size_t i = 1; i < offsets.size(); ++i)
+				offsets[i] += offsets[i - 1];
+
+			// american flag sort: swap every object into the next free place of its group
+			std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+			for(std::size_t group = 0; group < distinct.size(); ++group)
+			{
+				while(next[group] < offsets[group + 1])
+				{
+					std::size_t i = next[group];
+					std::size_t target = types[i];
+					if(target == group)
+					{
+						++next[group];
+						continue;
+					}
+					std::size_t j = next[target]++;
+					first[i].swap(first[j]);
+					std::swap(types[i], types[j]);
+				}
+			}
+			return offsets;
+		}
+
+		/// sorts a group of any-objects holding the same type
+		template<typename Any>
+		void sort_group(Any* first, Any* last)
+		{
+			if(last - first > 1 && has_value(*first))
+				less_entry(*first).sort(access::data(*first), static_cast<std::size_t>(last - first), sizeof(Any));
+		}
+	} // namespace _any_detail
+
+	/// orders any-objects by type and any-objects holding the same type by `operator<`
+	/**
+		Types are ordered by the address of their function table, which is consistent within a
+		program run but not across runs. Empty any-objects are ordered first. Can be used with
+		standard algorithms like std::merge to combine ranges sorted with sort_by_type.
+	*/
+	struct any_less
+	{
+		template<typename Any>
+		bool operator()(Any const& lhs, Any const& rhs) const
+		{
+			static_assert(is_any_v<Any>, "any_less orders any-objects");
+
+			auto lhs_type = _any_detail::access::type_id(lhs);
+			auto rhs_type = _any_detail::access::type_id(rhs);
+			if(lhs_type != rhs_type)
+				return lhs_type < rhs_type;
+			return lhs_type != 0
+			       && _any_detail::less_entry(lhs).function(_any_detail::access::data(lhs), _any_detail::access::data(rhs));
+		}
+	};
+
+	/// sorts the contiguous any-objects in [first, last) as ordered by any_less
+	/**
+		The objects are partitioned by type first. Every partition is then sorted by a kernel
+		for its concrete type, which compares with the inlined `operator<` of the type instead
+		of calling through the function table for every comparison.
+	*/
+	template<typename Any>
+	void sort_by_type(Any* first, Any* last)
+	{
+		static_assert(is_any_v<Any>, "sort_by_type sorts any-objects");
+
+		auto offsets = _any_detail::partition_by_type(first, last);
+		for(std::size_t group = 0; group + 1 < offsets.size(); ++group)
+			_any_detail::sort_group(first + offsets[group], first + offsets[group + 1]);
+	}
+
+	/// sorts the contiguous any-objects in [first, last) as ordered by any_less, sorting the partitions as `policy` permits
+	/**
+		`policy` is a standard execution policy like `std::execution::par`. This header does not
+		include `<execution>`, as some standard libraries require linking a parallel backend once
+		it is included.
+	*/
+	template<typename ExecutionPolicy, typename Any>
+	void sort_by_type(ExecutionPolicy&& policy, Any* first, Any* last)
+	{
+		static_assert(is_any_v<Any>, "sort_by_type sorts any-objects");
+
+		auto offsets = _any_detail::partition_by_type(first, last);
+		std::vector<std::size_t> groups(offsets.size() - 1);
+		std::iota(groups.begin(), groups.end(), std::size_t(0));
+		std::for_each(std::forward<ExecutionPolicy>(policy), groups.begin(), groups.end(), [&](std::size_t group) {
+			_any_detail::sort_group(first + offsets[group], first + offsets[group + 1]);
+		});
+	}
+} // namespace ext
+
+#endif // EXT_ANY_SORT_HEADER
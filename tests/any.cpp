@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include <ext/any.hpp>
 
+#include <stdexcept>
+
 TEST(is_any, static_assert)
 {
 	static_assert(!ext::is_any<int>::value);
@@ -375,3 +377,261 @@ TEST(any_special_member_fn, any_in_any)
 	static_assert(std::is_same_v<decltype(result2), int&>);
 	EXPECT_EQ(result2, 42);
 }
+
+struct throwing_copy
+{
+	static bool fail;
+	int value;
+
+	throwing_copy(int value) : value(value) { }
+	throwing_copy(throwing_copy const& other) : value(other.value)
+	{
+		if(fail)
+			throw std::runtime_error("copy failed");
+	}
+	throwing_copy(throwing_copy&& other) noexcept : value(other.value) { }
+};
+bool throwing_copy::fail = false;
+
+TEST(any_assignment, strong_exception_guarantee)
+{
+	using any_t = ext::base_any<16, 8, ext::iface::copy, ext::iface::move>;
+
+	throwing_copy::fail = false;
+	any_t a = throwing_copy{1};
+	any_t b = throwing_copy{2};
+
+	throwing_copy::fail = true;
+	EXPECT_THROW(a = b, std::runtime_error);
+	ASSERT_TRUE(ext::valid_cast<throwing_copy>(a));
+	EXPECT_EQ(ext::any_cast<throwing_copy>(a).value, 1);
+
+	EXPECT_THROW(a = ext::any_cast<throwing_copy>(b), std::runtime_error);
+	ASSERT_TRUE(ext::valid_cast<throwing_copy>(a));
+	EXPECT_EQ(ext::any_cast<throwing_copy>(a).value, 1);
+
+	throwing_copy::fail = false;
+	a = b;
+	EXPECT_EQ(ext::any_cast<throwing_copy>(a).value, 2);
+
+	a = 42;
+	b = throwing_copy{3};
+	a = b;
+	EXPECT_EQ(ext::any_cast<throwing_copy>(a).value, 3);
+}
+
+TEST(any_assignment, swap)
+{
+	using any_t = ext::base_any<16, 8, ext::iface::copy, ext::iface::move>;
+
+	any_t a = 42;
+	any_t b = 2.5;
+	swap(a, b);
+	EXPECT_EQ(ext::any_cast<double>(a), 2.5);
+	EXPECT_EQ(ext::any_cast<int>(b), 42);
+
+	any_t empty;
+	empty.swap(b);
+	EXPECT_FALSE(b.has_value());
+	EXPECT_EQ(ext::any_cast<int>(empty), 42);
+
+	{
+		any_t d1 = dummy{};
+		any_t d2 = 7;
+		dummy::copy        = 0;
+		dummy::copy_assign = 0;
+		dummy::move        = 0;
+		dummy::move_assign = 0;
+		dummy::dtor        = 0;
+		d1.swap(d2);
+		EXPECT_EQ(ext::any_cast<int>(d1), 7);
+		EXPECT_TRUE(ext::valid_cast<dummy>(d2));
+		EXPECT_EQ(dummy::copy       , 0);
+		EXPECT_EQ(dummy::copy_assign, 0);
+		EXPECT_EQ(dummy::move_assign, 0);
+		EXPECT_EQ(dummy::move       , dummy::dtor);
+	}
+}
+
+struct relocatable_payload
+{
+	static unsigned move;
+	int* value;
+
+	relocatable_payload(int v) : value(new int(v)) { }
+	relocatable_payload(relocatable_payload const& other) : value(new int(*other.value)) { }
+	relocatable_payload(relocatable_payload&& other) : value(other.value) { ++move; other.value = nullptr; }
+	~relocatable_payload() { delete value; }
+};
+unsigned relocatable_payload::move = 0;
+
+namespace ext
+{
+	template<>
+	struct is_trivially_relocatable<relocatable_payload> : std::true_type
+	{ };
+}
+
+TEST(any_assignment, trivially_relocatable)
+{
+	using any_t = ext::base_any<16, 8, ext::iface::copy, ext::iface::move>;
+
+	any_t a = relocatable_payload{1};
+	any_t b = relocatable_payload{2};
+	relocatable_payload::move = 0;
+
+	a = b;
+	swap(a, b);
+	EXPECT_EQ(relocatable_payload::move, 0);
+	EXPECT_EQ(*ext::any_cast<relocatable_payload>(a).value, 2);
+	EXPECT_EQ(*ext::any_cast<relocatable_payload>(b).value, 2);
+	EXPECT_NE(ext::any_cast<relocatable_payload>(a).value, ext::any_cast<relocatable_payload>(b).value);
+}
+
+TEST(any_interface, canonical_order)
+{
+	using any_t = ext::base_any<16, 8, ext::iface::copy, ext::iface::move, myinterface>;
+	using reordered_any_t = ext::base_any<32, 8, myinterface, ext::iface::move, ext::iface::copy, ext::iface::move>;
+
+	any_t a = 42;
+	reordered_any_t b = 42;
+#ifdef EXTANY_CANONICAL_INTERFACES
+	static_assert(std::is_same_v<
+		ext::_any_detail::vtable_t<ext::iface::copy, ext::iface::move, myinterface>,
+		ext::_any_detail::vtable_t<myinterface, ext::iface::move, ext::iface::copy>>);
+	EXPECT_EQ(ext::_any_detail::access::type_id(a), ext::_any_detail::access::type_id(b));
+#endif
+	EXPECT_EQ(b.call<myinterface>(0.5), 42.5);
+
+	reordered_any_t c = b;
+	EXPECT_EQ(ext::any_cast<int>(c), 42);
+
+	// the ordering is part of the mangled name of base_any
+	static_assert(std::is_same_v<any_t, ext::EXTANY_INTERFACE_ORDER::base_any<16, 8, ext::iface::copy, ext::iface::move, myinterface>>);
+}
+
+#ifdef EXTANY_HAS_CONSTEXPR
+namespace
+{
+	struct scale
+	{
+		int factor;
+	};
+
+	struct offset
+	{
+		int amount;
+		int unused;
+	};
+
+	struct apply
+	{
+		using signature_t = int(ext::iface::placeholder const&, int);
+
+		template<typename T>
+		static constexpr int invoke(T const& object, int value)
+		{
+			if constexpr(std::is_same_v<T, scale>)
+				return object.factor * value;
+			else
+				return object.amount + value;
+		}
+	};
+
+	struct bump
+	{
+		using signature_t = void(ext::iface::placeholder&);
+
+		template<typename T>
+		static constexpr void invoke(T& object)
+		{
+			++object.factor;
+		}
+	};
+
+	using constexpr_any_t = ext::base_any<8, 4, ext::iface::copy, apply>;
+
+	template<typename Any>
+	constexpr int bumped(int factor)
+	{
+		Any a = scale{factor};
+		a.template call<bump>();
+		Any b = a;
+		b.template call<bump>();
+		return ext::any_value_cast<scale>(b).factor;
+	}
+
+	// GCC cannot evaluate any-objects at compile time when built with -fsanitize=null
+	template<typename Any, typename BumpAny>
+	void constexpr_checks()
+	{
+		if constexpr(ext::_any_detail::constant_address_comparison_v)
+		{
+			// built at compile time, no static initialization
+			static constexpr Any handlers[] = {scale{2}, offset{3, 0}, scale{10}};
+
+			static_assert(handlers[0].template call<apply>(5) == 10);
+			static_assert(handlers[1].template call<apply>(5) == 8);
+			static_assert(ext::call<apply>(handlers[2], 5) == 50);
+
+			static_assert(ext::valid_cast<scale>(handlers[0]));
+			static_assert(!ext::valid_cast<scale>(handlers[1]));
+			static_assert(ext::any_value_cast<offset>(handlers[1]).amount == 3);
+			static_assert(ext::has_value(handlers[2]));
+			static_assert(!Any{}.has_value());
+
+			static_assert(bumped<BumpAny>(1) == 3);
+		}
+	}
+}
+
+TEST(any_constexpr, lookup_table)
+{
+	using bump_any_t = ext::base_any<8, 4, ext::iface::copy, bump>;
+	constexpr_checks<constexpr_any_t, bump_any_t>();
+
+	// the same operations are usable at run time
+	constexpr_any_t const handlers[] = {scale{2}, offset{3, 0}, scale{10}};
+	EXPECT_EQ(handlers[1].call<apply>(1), 4);
+	EXPECT_EQ(ext::any_cast<scale>(handlers[2]).factor, 10);
+	EXPECT_EQ(ext::any_value_cast<offset>(handlers[1]).amount, 3);
+	EXPECT_EQ(bumped<bump_any_t>(1), 3);
+	constexpr_any_t copy = handlers[0];
+	EXPECT_EQ(copy.call<apply>(3), 6);
+}
+#endif
+
+TEST(any_layout, policies)
+{
+	using default_t = ext::base_any<24, 8, ext::iface::copy>;
+	using vtable_first_t = ext::base_any<24, 8, ext::layout::vtable_first, ext::iface::copy>;
+	using padded_t = ext::base_any<24, 8, ext::iface::copy, ext::layout::padded<64>>;
+	using cache_aligned_t = ext::base_any<8, 8, ext::layout::cache_aligned, ext::layout::vtable_first, ext::iface::copy>;
+
+	static_assert(sizeof(default_t) == 32);
+	static_assert(sizeof(vtable_first_t) == 32);
+	static_assert(sizeof(padded_t) == 64 && alignof(padded_t) == 64);
+	static_assert(alignof(cache_aligned_t) >= 64 && sizeof(cache_aligned_t) == alignof(cache_aligned_t));
+	static_assert(sizeof(ext::base_any<24, 16, ext::layout::vtable_first>) == 48);
+
+	default_t d = 1;
+	vtable_first_t v = 2;
+	padded_t p = 3;
+	cache_aligned_t c = 4;
+
+	auto offset = [](auto const& a) { return ext::_any_detail::access::data(a) - reinterpret_cast<char const*>(&a); };
+	EXPECT_EQ(offset(d), 0);
+	EXPECT_EQ(offset(v), 8);
+	EXPECT_EQ(offset(p), 0);
+	EXPECT_EQ(offset(c), 8);
+
+	// layout policies do not change the function table
+	EXPECT_EQ(ext::_any_detail::access::type_id(d), ext::_any_detail::access::type_id(p));
+
+	vtable_first_t v2 = v;
+	cache_aligned_t c2;
+	c2 = c;
+	EXPECT_EQ(ext::any_cast<int>(v2), 2);
+	EXPECT_EQ(ext::any_cast<int>(c2), 4);
+	EXPECT_TRUE(ext::valid_cast<int>(p));
+}
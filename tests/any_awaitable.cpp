@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+#include <ext/any_awaitable.hpp>
+
+#ifdef EXTANY_HAS_COROUTINES
+#include <exception>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	using int_awaitable_t = ext::any_awaitable<32, int>;
+
+	/// completes immediately
+	struct ready_value
+	{
+		int value;
+
+		bool await_ready() const { return true; }
+		void await_suspend(std::coroutine_handle<>) const { }
+		int await_resume() const { return value; }
+	};
+
+	/// completes once the scheduler resumes the awaiting coroutine, like a timer or an I/O completion
+	struct deferred_value
+	{
+		ext::any_scheduler* scheduler;
+		int value;
+
+		bool await_ready() const { return false; }
+		void await_suspend(std::coroutine_handle<> awaiting) const { scheduler->post(awaiting); }
+		int await_resume() const { return value; }
+	};
+
+	/// decides in await_suspend not to suspend
+	struct declined_suspend
+	{
+		int value;
+
+		bool await_ready() const { return false; }
+		bool await_suspend(std::coroutine_handle<>) const { return false; }
+		int await_resume() const { return value; }
+	};
+
+	ext::any_scheduler::task sum_awaitables(std::vector<int_awaitable_t>& awaitables, int& sum)
+	{
+		for(auto& awaitable : awaitables)
+			sum += co_await awaitable;
+	}
+
+	/// counts its destructions, to tell when a coroutine frame is destroyed
+	struct frame_guard
+	{
+		int& destroyed;
+
+		~frame_guard()
+		{
+			++destroyed;
+		}
+	};
+
+	/// coroutine owned by its caller instead of a scheduler, destroying its frame with itself
+	class owned_coroutine
+	{
+	public:
+		struct promise_type
+		{
+			owned_coroutine get_return_object()
+			{
+				return owned_coroutine{std::coroutine_handle<promise_type>::from_promise(*this)};
+			}
+
+			std::suspend_never initial_suspend() noexcept { return {}; }
+			std::suspend_always final_suspend() noexcept { return {}; }
+			void return_void() { }
+			void unhandled_exception() { std::terminate(); }
+		};
+
+		owned_coroutine(owned_coroutine&& other) noexcept
+			: handle(std::exchange(other.handle, nullptr))
+		{ }
+
+		owned_coroutine& operator=(owned_coroutine&&) = delete;
+
+		~owned_coroutine()
+		{
+			if(handle)
+				handle.destroy();
+		}
+
+		bool done() const
+		{
+			return handle.done();
+		}
+
+	private:
+		explicit owned_coroutine(std::coroutine_handle<promise_type> handle)
+			: handle(handle)
+		{ }
+
+		std::coroutine_handle<promise_type> handle;
+	};
+
+	owned_coroutine yield_once(ext::any_scheduler& scheduler, int& destroyed)
+	{
+		frame_guard guard{destroyed};
+		co_await scheduler.yield();
+	}
+
+	/// never resumes the awaiting coroutine, like an operation which is never completed
+	struct never_completed
+	{
+		bool await_ready() const { return false; }
+		void await_suspend(std::coroutine_handle<>) const { }
+		void await_resume() const { }
+	};
+
+	ext::any_scheduler::task wait_forever(int& destroyed)
+	{
+		frame_guard guard{destroyed};
+		co_await ext::any_awaitable<8>{never_completed{}};
+	}
+
+	ext::any_scheduler::task count_yields(ext::any_scheduler& scheduler, std::vector<int>& trace, int id)
+	{
+		for(int i = 0; i < 3; ++i)
+		{
+			trace.push_back(id);
+			co_await scheduler.yield();
+		}
+	}
+} // namespace
+
+TEST(any_awaitable, await_protocol)
+{
+	ext::any_scheduler scheduler;
+	std::vector<int_awaitable_t> awaitables;
+	awaitables.emplace_back(ready_value{1});
+	awaitables.emplace_back(deferred_value{&scheduler, 10});
+	awaitables.emplace_back(declined_suspend{100});
+	awaitables.emplace_back(deferred_value{&scheduler, 1000});
+
+	int sum = 0;
+	scheduler.spawn(sum_awaitables(awaitables, sum));
+	EXPECT_EQ(sum, 0); // tasks start when the scheduler runs
+
+	EXPECT_EQ(scheduler.run(), 3u); // start and two deferred values
+	EXPECT_EQ(sum, 1111);
+	EXPECT_TRUE(scheduler.empty());
+}
+
+TEST(any_awaitable, void_result)
+{
+	ext::any_scheduler scheduler;
+	bool done = false;
+	auto wait = [](ext::any_awaitable<16> awaitable, bool& done) -> ext::any_scheduler::task {
+		co_await awaitable;
+		done = true;
+	};
+	scheduler.spawn(wait(scheduler.yield(), done));
+	scheduler.run();
+	EXPECT_TRUE(done);
+}
+
+TEST(any_awaitable, scheduler_round_robin)
+{
+	ext::any_scheduler scheduler;
+	std::vector<int> trace;
+	scheduler.spawn(count_yields(scheduler, trace, 1));
+	scheduler.spawn(count_yields(scheduler, trace, 2));
+	scheduler.run();
+	EXPECT_EQ(trace, (std::vector<int>{1, 2, 1, 2, 1, 2}));
+}
+
+TEST(any_awaitable, unfinished_tasks)
+{
+	std::vector<int> trace;
+	{
+		ext::any_scheduler scheduler;
+		scheduler.spawn(count_yields(scheduler, trace, 1));
+		auto unspawned = count_yields(scheduler, trace, 2);
+	} // destroys both coroutines without running them
+	EXPECT_TRUE(trace.empty());
+}
+TEST(any_awaitable, posted_coroutines_are_not_owned)
+{
+	int destroyed = 0;
+	{
+		owned_coroutine coroutine = [&] {
+			ext::any_scheduler scheduler;
+			auto queued = yield_once(scheduler, destroyed);
+			EXPECT_FALSE(scheduler.empty());
+			return queued;
+		}(); // the scheduler is destroyed while the coroutine is queued
+		EXPECT_EQ(destroyed, 0);
+		EXPECT_FALSE(coroutine.done());
+	} // its owner destroys it
+	EXPECT_EQ(destroyed, 1);
+
+	destroyed = 0;
+	ext::any_scheduler scheduler;
+	{
+		owned_coroutine coroutine = yield_once(scheduler, destroyed);
+		scheduler.run();
+		EXPECT_TRUE(coroutine.done());
+	}
+	EXPECT_EQ(destroyed, 1);
+}
+
+TEST(any_awaitable, suspended_tasks)
+{
+	int destroyed = 0;
+	{
+		ext::any_scheduler scheduler;
+		scheduler.spawn(wait_forever(destroyed));
+		scheduler.run();
+		EXPECT_TRUE(scheduler.empty());
+		EXPECT_EQ(destroyed, 0);
+	} // destroys the task suspended on an awaitable which is never completed
+	EXPECT_EQ(destroyed, 1);
+}
+#endif
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <ext/any_event_bus.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace
+{
+	struct key_pressed
+	{
+		char key;
+	};
+
+	struct mouse_moved
+	{
+		int x;
+		int y;
+	};
+}
+
+TEST(any_event_bus, publish)
+{
+	using message_t = ext::any<16>;
+
+	ext::any_event_bus<message_t> bus;
+	std::string keys;
+	int distance = 0;
+	int handled = 0;
+
+	bus.subscribe<key_pressed>([&keys](key_pressed const& event) { keys += event.key; });
+	bus.subscribe<mouse_moved>([&distance](mouse_moved const& event) { distance += event.x + event.y; });
+	bus.subscribe<key_pressed>([&handled](key_pressed const&) { ++handled; });
+
+	EXPECT_EQ(bus.subscriber_count<key_pressed>(), 2u);
+	EXPECT_EQ(bus.subscriber_count<mouse_moved>(), 1u);
+	EXPECT_EQ(bus.subscriber_count<int>(), 0u);
+
+	bus.publish(key_pressed{'a'});
+	bus.publish(mouse_moved{1, 2});
+	bus.publish(key_pressed{'b'});
+	bus.publish(message_t{42});
+	bus.publish(message_t{});
+
+	EXPECT_EQ(keys, "ab");
+	EXPECT_EQ(distance, 3);
+	EXPECT_EQ(handled, 2);
+}
+
+TEST(any_event_bus, many_types)
+{
+	using message_t = ext::any<16>;
+
+	ext::any_event_bus<message_t> bus;
+	std::vector<int> counts(5, 0);
+
+	// enough types to force the lookup table to grow
+	bus.subscribe<char>([&counts](char) { ++counts[0]; });
+	bus.subscribe<short>([&counts](short) { ++counts[1]; });
+	bus.subscribe<int>([&counts](int) { ++counts[2]; });
+	bus.subscribe<long>([&counts](long) { ++counts[3]; });
+	bus.subscribe<float>([&counts](float) { ++counts[4]; });
+	bus.subscribe<double>([&counts](double v) { counts[0] += static_cast<int>(v); });
+	bus.subscribe<key_pressed>([&counts](key_pressed) { ++counts[1]; });
+	bus.subscribe<mouse_moved>([&counts](mouse_moved) { ++counts[2]; });
+	bus.subscribe<char>([&counts](char) { ++counts[3]; });
+
+	bus.publish('x');
+	bus.publish(short{1});
+	bus.publish(3);
+	bus.publish(4L);
+	bus.publish(5.0f);
+	bus.publish(10.0);
+	bus.publish(key_pressed{'k'});
+	bus.publish(mouse_moved{0, 0});
+
+	EXPECT_EQ(counts, (std::vector<int>{11, 2, 2, 2, 1}));
+
+	bus.clear();
+	bus.publish('x');
+	EXPECT_EQ(bus.subscriber_count<char>(), 0u);
+	EXPECT_EQ(counts[0], 11);
+}
+
+TEST(any_event_bus, publish_batch)
+{
+	using message_t = ext::any<16>;
+
+	ext::any_event_bus<message_t> bus;
+	std::string keys;
+	std::vector<int> values;
+
+	bus.subscribe<key_pressed>([&keys](key_pressed const& event) { keys += event.key; });
+	bus.subscribe<int>([&values](int value) { values.push_back(value); });
+
+	std::vector<message_t> messages;
+	messages.emplace_back(key_pressed{'a'});
+	messages.emplace_back(1);
+	messages.emplace_back(2.5);
+	messages.emplace_back(key_pressed{'b'});
+	messages.emplace_back(2);
+	messages.emplace_back(key_pressed{'c'});
+
+	bus.publish_batch(messages);
+
+	EXPECT_EQ(keys, "abc");
+	EXPECT_EQ(values, (std::vector<int>{1, 2}));
+}
+
+TEST(any_event_bus, nested_publish_batch)
+{
+	using message_t = ext::any<16>;
+
+	ext::any_event_bus<message_t> bus;
+	std::vector<int> values;
+	std::string keys;
+
+	bus.subscribe<key_pressed>([&bus](key_pressed const& event) {
+		if(event.key == 'a')
+			bus.publish_batch({message_t{100}, message_t{key_pressed{'n'}}});
+	});
+	bus.subscribe<key_pressed>([&keys](key_pressed const& event) { keys += event.key; });
+	bus.subscribe<int>([&values](int value) { values.push_back(value); });
+
+	std::vector<message_t> messages;
+	messages.emplace_back(key_pressed{'a'});
+	messages.emplace_back(1);
+	messages.emplace_back(2);
+	messages.emplace_back(key_pressed{'b'});
+	bus.publish_batch(messages);
+
+	// the nested batch is delivered completely while the first handler runs
+	EXPECT_EQ(keys, "nab");
+	ASSERT_EQ(values.size(), 3u);
+	values.erase(std::remove(values.begin(), values.end(), 100), values.end()); // types are not delivered in batch order
+	EXPECT_EQ(values, (std::vector<int>{1, 2}));
+}
+
+TEST(any_event_bus, subscribe_during_dispatch)
+{
+	using message_t = ext::any<16>;
+
+	ext::any_event_bus<message_t> bus;
+	int mouse_events = 0;
+	int key_events = 0;
+
+	bus.subscribe<key_pressed>([&](key_pressed const&) {
+		++key_events;
+		auto subscribed = bus.subscriber_count<mouse_moved>();
+		// enough subscriptions to reallocate the handlers and grow the lookup table
+		for(int i = 0; i < 16; ++i)
+			bus.subscribe<mouse_moved>([&mouse_events](mouse_moved const&) { ++mouse_events; });
+		bus.subscribe<key_pressed>([&key_events](key_pressed const&) { key_events += 100; });
+		EXPECT_EQ(bus.subscriber_count<mouse_moved>(), subscribed); // applied after dispatch
+	});
+
+	bus.publish(key_pressed{'a'});
+	EXPECT_EQ(key_events, 1);
+	EXPECT_EQ(bus.subscriber_count<mouse_moved>(), 16u);
+	EXPECT_EQ(bus.subscriber_count<key_pressed>(), 2u);
+
+	bus.publish(mouse_moved{1, 1});
+	EXPECT_EQ(mouse_events, 16);
+
+	bus.publish_batch({message_t{key_pressed{'b'}}, message_t{mouse_moved{2, 2}}});
+	EXPECT_EQ(key_events, 102);
+	EXPECT_EQ(mouse_events, 32);
+	EXPECT_EQ(bus.subscriber_count<mouse_moved>(), 32u);
+	EXPECT_EQ(bus.subscriber_count<key_pressed>(), 3u);
+}
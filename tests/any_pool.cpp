@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <ext/any_pool.hpp>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct counted
+	{
+		static int destructions;
+		int value;
+
+		~counted()
+		{
+			++destructions;
+		}
+	};
+
+	int counted::destructions = 0;
+} // namespace
+
+TEST(any_pool, create_destroy)
+{
+	using any_t = ext::any<40>;
+	using pool_t = ext::any_pool<any_t, 8>;
+
+	std::vector<any_t*> objects;
+	for(int i = 0; i < 20; ++i)
+		objects.push_back(i % 2 ? pool_t::create(i) : pool_t::create(std::to_string(i)));
+
+	for(int i = 0; i < 20; ++i)
+	{
+		if(i % 2)
+			EXPECT_EQ(ext::any_cast<int>(*objects[i]), i);
+		else
+			EXPECT_EQ(ext::any_cast<std::string>(*objects[i]), std::to_string(i));
+	}
+
+	for(auto* object : objects)
+		pool_t::destroy(object);
+
+	// slots are recycled
+	any_t* reused = pool_t::create();
+	EXPECT_NE(std::find(objects.begin(), objects.end(), reused), objects.end());
+	EXPECT_FALSE(reused->has_value());
+	pool_t::destroy(reused);
+
+	auto stats = pool_t::stats();
+	EXPECT_EQ(stats.capacity % pool_t::batch_size, 0u);
+	EXPECT_GE(stats.capacity, 20u);
+	EXPECT_GE(stats.high_water, 20u);
+}
+
+TEST(any_pool, trivial_destruction)
+{
+	using any_t = ext::any<24>;
+	using pool_t = ext::any_pool<any_t>;
+
+	auto const& trivial = static_cast<ext::_any_detail::table_entry<ext::iface::destroy> const&>(
+		ext::_any_detail::function_table<long, ext::iface::copy>);
+	EXPECT_EQ(trivial.function, nullptr);
+
+	counted::destructions = 0;
+	any_t* object = pool_t::create(counted{1});
+	int const temporaries = counted::destructions;
+	pool_t::destroy(object);
+	EXPECT_EQ(counted::destructions, temporaries + 1);
+}
+
+TEST(any_pool, threads)
+{
+	using any_t = ext::any<64>;
+	using pool_t = ext::any_pool<any_t, 16>;
+
+	constexpr int rounds = 2000;
+	auto churn = [] {
+		std::vector<any_t*> objects;
+		for(int i = 0; i < rounds; ++i)
+		{
+			objects.push_back(pool_t::create(i));
+			if(i % 3 == 0)
+			{
+				for(auto* object : objects)
+					pool_t::destroy(object);
+				objects.clear();
+			}
+		}
+		for(auto* object : objects)
+			pool_t::destroy(object);
+	};
+
+	std::vector<std::thread> threads;
+	for(int i = 0; i < 4; ++i)
+		threads.emplace_back(churn);
+	for(auto& thread : threads)
+		thread.join();
+
+	auto stats = pool_t::stats();
+	EXPECT_EQ(stats.creates, 4u * rounds);
+	EXPECT_GT(stats.hit_rate(), 0.9);
+	EXPECT_LE(stats.high_water, stats.capacity);
+	EXPECT_LE(stats.capacity, 4u * 3 * pool_t::batch_size);
+}
+
+TEST(any_pool, cross_thread_destruction)
+{
+	using any_t = ext::any<32>;
+	using pool_t = ext::any_pool<any_t, 4>;
+
+	std::vector<any_t*> objects;
+	for(int i = 0; i < 100; ++i)
+		objects.push_back(pool_t::create(i));
+
+	std::thread([&objects] {
+		for(auto* object : objects)
+			pool_t::destroy(object);
+	}).join();
+
+	// the exiting thread returned the slots to the global list
+	auto capacity = pool_t::stats().capacity;
+	for(int i = 0; i < 100; ++i)
+		pool_t::destroy(pool_t::create(i));
+	EXPECT_EQ(pool_t::stats().capacity, capacity);
+}
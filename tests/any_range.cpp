@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <ext/any_range.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+struct counting_source
+{
+	int current;
+	int last;
+	unsigned* calls;
+
+	std::size_t next(int* out, std::size_t count)
+	{
+		++*calls;
+		std::size_t n = 0;
+		for(; n < count && current < last; ++n)
+			out[n] = current++;
+		return n;
+	}
+};
+
+TEST(any_range, range_for)
+{
+	using range_t = ext::any_range<int, 24, 8, 16>;
+
+	unsigned calls = 0;
+	range_t range = counting_source{0, 100, &calls};
+
+	int expected = 0;
+	for(int value : range)
+		EXPECT_EQ(value, expected++);
+
+	EXPECT_EQ(expected, 100);
+	EXPECT_EQ(calls, 100 / 16 + 2); // full chunks, the remainder and the final empty chunk
+}
+
+TEST(any_range, algorithms)
+{
+	using range_t = ext::any_range<int, 24, 8, 16>;
+
+	unsigned calls = 0;
+	range_t range = counting_source{1, 11, &calls};
+	EXPECT_EQ(std::accumulate(range.begin(), range.end(), 0), 55);
+
+	range_t range2 = counting_source{0, 50, &calls};
+	auto found = std::find_if(range2.begin(), range2.end(), [](int v) { return v > 20; });
+	ASSERT_NE(found, range2.end());
+	EXPECT_EQ(*found, 21);
+
+	// the range is an input range: iteration continues at the found element
+	std::vector<int> rest(range2.begin(), range2.end());
+	ASSERT_EQ(rest.size(), 29u);
+	EXPECT_EQ(rest.front(), 21);
+	EXPECT_EQ(rest.back(), 49);
+}
+
+TEST(any_range, heterogeneous_sources)
+{
+	using range_t = ext::any_range<int, 32>;
+
+	std::vector<int> values{3, 1, 4, 1, 5};
+	unsigned calls = 0;
+
+	std::vector<range_t> ranges;
+	ranges.push_back(ext::make_any_range<int, 32>(values.begin(), values.end()));
+	ranges.push_back(counting_source{0, 3, &calls});
+	ranges.emplace_back();
+
+	std::vector<int> result;
+	for(auto& range : ranges)
+		std::copy(range.begin(), range.end(), std::back_inserter(result));
+
+	EXPECT_EQ(result, (std::vector<int>{3, 1, 4, 1, 5, 0, 1, 2}));
+}
+
+TEST(any_range, postfix_increment)
+{
+	std::vector<int> values{7, 8, 9};
+	auto range = ext::make_any_range<int, 32, 8, 2>(values.begin(), values.end());
+
+	auto it = range.begin();
+	EXPECT_EQ(*it++, 7);
+	EXPECT_EQ(*it++, 8);
+	EXPECT_EQ(*it, 9);
+	++it;
+	EXPECT_EQ(it, range.end());
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <ext/any_sort.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#ifdef EXTANY_TEST_EXECUTION
+#include <execution>
+#endif
+
+using sortable_t = ext::base_any<32, 8, ext::iface::copy, ext::iface::move, ext::iface::less>;
+
+namespace
+{
+	std::vector<sortable_t> make_records()
+	{
+		std::vector<sortable_t> records;
+		for(int i = 0; i < 50; ++i)
+		{
+			records.emplace_back((i * 37) % 50);
+			records.emplace_back(std::string(1, static_cast<char>('a' + (i * 11) % 26)));
+			if(i % 7 == 0)
+				records.emplace_back();
+			if(i % 3 == 0)
+				records.emplace_back(static_cast<double>(i) / 4);
+		}
+		return records;
+	}
+
+	template<typename T>
+	std::vector<T> values_of(std::vector<sortable_t> const& records)
+	{
+		std::vector<T> values;
+		for(auto const& record : records)
+			if(ext::valid_cast<T>(record))
+				values.push_back(ext::any_cast<T>(record));
+		return values;
+	}
+} // namespace
+
+TEST(any_sort, any_less)
+{
+	sortable_t empty;
+	sortable_t one = 1;
+	sortable_t two = 2;
+	sortable_t text = std::string("1");
+
+	ext::any_less less;
+	EXPECT_FALSE(less(empty, empty));
+	EXPECT_TRUE(less(empty, one));
+	EXPECT_TRUE(less(one, two));
+	EXPECT_FALSE(less(two, one));
+	EXPECT_FALSE(less(one, one));
+	EXPECT_NE(less(one, text), less(text, one));
+}
+
+TEST(any_sort, sort_by_type)
+{
+	auto records = make_records();
+	auto expected = records;
+	std::stable_sort(expected.begin(), expected.end(), ext::any_less{});
+
+	ext::sort_by_type(records.data(), records.data() + records.size());
+
+	ASSERT_EQ(records.size(), expected.size());
+	EXPECT_TRUE(std::is_sorted(records.begin(), records.end(), ext::any_less{}));
+	for(std::size_t i = 0; i < records.size(); ++i)
+		EXPECT_EQ(records[i].type(), expected[i].type());
+
+	EXPECT_EQ(values_of<int>(records), values_of<int>(expected));
+	EXPECT_EQ(values_of<std::string>(records), values_of<std::string>(expected));
+	EXPECT_EQ(values_of<double>(records), values_of<double>(expected));
+	EXPECT_FALSE(ext::has_value(records.front()));
+}
+
+TEST(any_sort, merge)
+{
+	auto records = make_records();
+	auto middle = records.begin() + static_cast<std::ptrdiff_t>(records.size() / 2);
+	std::vector<sortable_t> left(records.begin(), middle);
+	std::vector<sortable_t> right(middle, records.end());
+	ext::sort_by_type(left.data(), left.data() + left.size());
+	ext::sort_by_type(right.data(), right.data() + right.size());
+
+	std::vector<sortable_t> merged;
+	std::merge(left.begin(), left.end(), right.begin(), right.end(), std::back_inserter(merged), ext::any_less{});
+
+	ext::sort_by_type(records.data(), records.data() + records.size());
+	ASSERT_EQ(merged.size(), records.size());
+	EXPECT_TRUE(std::is_sorted(merged.begin(), merged.end(), ext::any_less{}));
+	EXPECT_EQ(values_of<std::string>(merged), values_of<std::string>(records));
+}
+
+#ifdef EXTANY_TEST_EXECUTION
+TEST(any_sort, execution_policy)
+{
+	auto records = make_records();
+	auto expected = records;
+	ext::sort_by_type(expected.data(), expected.data() + expected.size());
+
+	ext::sort_by_type(std::execution::par, records.data(), records.data() + records.size());
+	EXPECT_EQ(values_of<int>(records), values_of<int>(expected));
+	EXPECT_EQ(values_of<std::string>(records), values_of<std::string>(expected));
+}
+#endif
@@ -0,0 +1,220 @@
+#include <gtest/gtest.h>
+#include <ext/any.hpp>
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	std::atomic<long> live_objects{0};
+
+	/// payload checking its own integrity, N adds bytes to vary the size
+	template<std::size_t N>
+	struct tracked
+	{
+		long value;
+		long check;
+		char padding[N];
+
+		explicit tracked(long value)
+			: value(value)
+			, check(~value)
+			, padding{}
+		{
+			++live_objects;
+		}
+
+		tracked(tracked const& other)
+			: value(other.value)
+			, check(other.check)
+			, padding{}
+		{
+			EXPECT_TRUE(other.valid());
+			++live_objects;
+		}
+
+		~tracked()
+		{
+			EXPECT_TRUE(valid());
+			check = 0; // detects double destruction
+			--live_objects;
+		}
+
+		bool valid() const
+		{
+			return check == ~value;
+		}
+	};
+
+	using stress_t = ext::base_any<48, 8, ext::iface::copy, ext::iface::move>;
+
+	stress_t make_payload(long value)
+	{
+		switch(value % 4)
+		{
+		case 0: return tracked<1>{value};
+		case 1: return tracked<32>{value};
+		case 2: return std::string(static_cast<std::size_t>(value % 40), 'x');
+		default: return stress_t{};
+		}
+	}
+
+	void check_payload(stress_t const& a)
+	{
+		if(ext::valid_cast<tracked<1>>(a))
+		{
+			EXPECT_TRUE(ext::any_cast<tracked<1>>(a).valid());
+		}
+		else if(ext::valid_cast<tracked<32>>(a))
+		{
+			EXPECT_TRUE(ext::any_cast<tracked<32>>(a).valid());
+		}
+		else if(ext::valid_cast<std::string>(a))
+		{
+			EXPECT_LT(ext::any_cast<std::string>(a).size(), 40u);
+		}
+	}
+
+	/// applies random assignments, swaps and resets to a vector of any-objects
+	void shuffle_slots(unsigned seed, int rounds)
+	{
+		std::mt19937 random(seed);
+		std::vector<stress_t> slots(16);
+		for(int round = 0; round < rounds; ++round)
+		{
+			std::size_t target = random() % slots.size();
+			std::size_t source = random() % slots.size();
+			switch(random() % 7)
+			{
+			case 0: slots[target] = make_payload(static_cast<long>(random() % 1000)); break;
+			case 1: slots[target] = slots[source]; break;
+			case 2: slots[target] = std::move(slots[source]); break;
+			case 3: slots[target].swap(slots[source]); break;
+			case 4: slots[target].reset(); break;
+			case 5: slots.push_back(stress_t{slots[source]}); break; // growth relocates all slots
+			default:
+				if(slots.size() > 4)
+					slots.pop_back();
+				break;
+			}
+			for(auto const& slot : slots)
+				check_payload(slot);
+		}
+	}
+} // namespace
+
+TEST(any_stress, lifetimes)
+{
+	std::vector<std::thread> threads;
+	for(unsigned i = 0; i < 4; ++i)
+		threads.emplace_back(shuffle_slots, i, 5000);
+	for(auto& thread : threads)
+		thread.join();
+
+	EXPECT_EQ(live_objects, 0);
+}
+
+TEST(any_stress, handoff)
+{
+	std::mutex mutex;
+	std::deque<stress_t> queue;
+	std::atomic<int> producers_running{2};
+
+	auto produce = [&](long first) {
+		for(long i = first; i < first + 10000; ++i)
+		{
+			stress_t payload = make_payload(i);
+			std::lock_guard<std::mutex> lock(mutex);
+			queue.push_back(std::move(payload));
+		}
+		--producers_running;
+	};
+
+	auto consume = [&] {
+		for(;;)
+		{
+			stress_t payload;
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				if(queue.empty())
+				{
+					if(producers_running == 0)
+						return;
+					continue;
+				}
+				payload = std::move(queue.front());
+				queue.pop_front();
+			}
+			check_payload(payload);
+		}
+	};
+
+	std::vector<std::thread> threads;
+	threads.emplace_back(produce, 0);
+	threads.emplace_back(produce, 10000);
+	threads.emplace_back(consume);
+	threads.emplace_back(consume);
+	for(auto& thread : threads)
+		thread.join();
+
+	EXPECT_TRUE(queue.empty());
+	EXPECT_EQ(live_objects, 0);
+}
+
+#ifdef EXTANY_CHECKS
+TEST(any_checked, destroyed_sentinel)
+{
+	struct alignas(stress_t) buffer_t
+	{
+		unsigned char bytes[sizeof(stress_t)];
+	};
+	auto buffer = std::make_unique<buffer_t>();
+
+	auto* a = new(buffer->bytes) stress_t(tracked<1>{7});
+	a->~stress_t();
+#if GTEST_HAS_DEATH_TEST
+	::testing::FLAGS_gtest_death_test_style = "threadsafe"; // sanitizers run background threads
+	EXPECT_DEATH(a->has_value(), "destroyed");
+	EXPECT_DEATH(stress_t{*a}, "destroyed");
+#endif
+
+	// constructing in the storage of a destroyed any-object revives it
+	a = new(buffer->bytes) stress_t(tracked<1>{8});
+	EXPECT_TRUE(a->has_value());
+	EXPECT_EQ(ext::any_cast<tracked<1>>(*a).value, 8);
+	a->~stress_t();
+	EXPECT_EQ(live_objects, 0);
+}
+#endif
+
+#ifdef EXTANY_ASAN_POISONING
+TEST(any_checked, poisoned_storage)
+{
+	stress_t a;
+	char* data = ext::_any_detail::access::data(a);
+	EXPECT_TRUE(__asan_address_is_poisoned(data));
+
+	a = tracked<1>{1};
+	EXPECT_FALSE(__asan_address_is_poisoned(data));
+
+	stress_t b = std::move(a);
+	EXPECT_FALSE(__asan_address_is_poisoned(data)); // moved-from objects are valid
+
+	a.reset();
+	EXPECT_TRUE(__asan_address_is_poisoned(data));
+#if GTEST_HAS_DEATH_TEST
+	::testing::FLAGS_gtest_death_test_style = "threadsafe";
+	EXPECT_DEATH(*static_cast<char volatile*>(data) = 0, "use-after-poison");
+#endif
+
+	a.swap(b);
+	EXPECT_FALSE(__asan_address_is_poisoned(data));
+	EXPECT_TRUE(__asan_address_is_poisoned(ext::_any_detail::access::data(b)));
+}
+#endif